@@ -1,5 +1,25 @@
 #include "DAC.h"
 #include "frdm_bsp.h"
+#include "prof.h"
+
+#define DAC_DMA_CH						0			// Kanał DMA strumienia próbek
+#define DMAMUX_SRC_TPM0_OVF		54		// Źródło żądania DMA: przepełnienie licznika TPM0
+
+static void (*streamHalfDone)(void);	// Wywoływana po wysłaniu każdej połowy bufora
+static uint32_t streamHalfBytes;			// Rozmiar połowy bufora w bajtach
+
+/**
+ * @brief TPM0 jako zegar próbkowania - przepełnienie z częstotliwością rate.
+ */
+static void dac_clock(uint32_t rate, uint32_t sc)
+{
+	SIM->SCGC6 |= SIM_SCGC6_TPM0_MASK;
+	SIM->SOPT2 |= SIM_SOPT2_TPMSRC(1);		// Zegar TPM = MCGFLLCLK (= SystemCoreClock)
+	TPM0->SC = 0;
+	TPM0->CNT = 0;
+	TPM0->MOD = (SystemCoreClock + rate / 2) / rate - 1;	// Najbliższy dzielnik (22050 Hz: błąd 0.005%)
+	TPM0->SC = sc | TPM_SC_CMOD(1);
+}
 
 void DAC_Init(void)
 {
@@ -26,3 +46,52 @@ uint8_t DAC_Load_Trig(uint16_t load)
 	DAC0->C0 |= DAC_C0_DACSWTRG_MASK;		// Przełączenie na następną daną z bufora (przed chwilą załadowaną)
 	return (0);
 }
+
+void DAC_Stream_Start(const uint16_t *buf, uint16_t samples, uint32_t rate, void (*halfDone)(void))
+{
+	// Bufor cykliczny: samples = potęga 2, adres wyrównany do rozmiaru w bajtach
+	uint32_t bytes = samples * sizeof(uint16_t);
+	uint8_t smod = 1;
+	while ((8u << smod) < bytes) smod++;	// SMOD: n -> okno 2^(n+3) bajtów
+
+	streamHalfDone = halfDone;
+	streamHalfBytes = bytes / 2;
+
+	SIM->SCGC6 |= SIM_SCGC6_DMAMUX_MASK;
+	SIM->SCGC7 |= SIM_SCGC7_DMA_MASK;
+
+	DAC0->C1 &= ~DAC_C1_DACBFEN_MASK;			// Bufor DAC wyłączony - zapis DAT[0] od razu na wyjście
+
+	// DMA: 16 bit z bufora cyklicznego do DAT[0], jeden transfer na przepełnienie TPM0
+	DMAMUX0->CHCFG[DAC_DMA_CH] = 0;
+	DMA0->DMA[DAC_DMA_CH].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	DMA0->DMA[DAC_DMA_CH].SAR = (uint32_t)buf;
+	DMA0->DMA[DAC_DMA_CH].DAR = (uint32_t)&DAC0->DAT[0].DATL;
+	DMA0->DMA[DAC_DMA_CH].DSR_BCR = DMA_DSR_BCR_BCR(streamHalfBytes);
+	DMA0->DMA[DAC_DMA_CH].DCR = DMA_DCR_EINT_MASK | DMA_DCR_ERQ_MASK | DMA_DCR_CS_MASK
+														| DMA_DCR_SINC_MASK | DMA_DCR_SSIZE(2) | DMA_DCR_DSIZE(2)
+														| DMA_DCR_SMOD(smod) | DMA_DCR_D_REQ_MASK;
+	DMAMUX0->CHCFG[DAC_DMA_CH] = DMAMUX_CHCFG_ENBL_MASK | DMAMUX_CHCFG_SOURCE(DMAMUX_SRC_TPM0_OVF);
+
+	NVIC_SetPriority(DMA0_IRQn, 0);				// Przeładowanie musi zdążyć przed kolejną próbką
+	NVIC_ClearPendingIRQ(DMA0_IRQn);
+	NVIC_EnableIRQ(DMA0_IRQn);
+
+	dac_clock(rate, TPM_SC_DMA_MASK);			// Żądanie DMA przy każdym przepełnieniu
+}
+
+void DAC_Clock_Start(uint32_t rate)
+{
+	dac_clock(rate, TPM_SC_TOIE_MASK);		// Przerwanie TPM0_IRQHandler na próbkę
+}
+
+void DMA0_IRQHandler(void)
+{
+	uint16_t t0 = Prof_Now();
+	// Koniec połowy bufora - przeładowanie licznika bajtów, adres źródła zawija się sam (SMOD)
+	DMA0->DMA[DAC_DMA_CH].DSR_BCR = DMA_DSR_BCR_DONE_MASK;
+	DMA0->DMA[DAC_DMA_CH].DSR_BCR = DMA_DSR_BCR_BCR(streamHalfBytes);
+	DMA0->DMA[DAC_DMA_CH].DCR |= DMA_DCR_ERQ_MASK;	// D_REQ wyłącza żądania po bloku
+	streamHalfDone();
+	Prof_End(PROF_SAMPLE, t0);
+}
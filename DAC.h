@@ -2,3 +2,5 @@
 
 void DAC_Init(void);
 uint8_t DAC_Load_Trig(uint16_t load);
+void DAC_Stream_Start(const uint16_t *buf, uint16_t samples, uint32_t rate, void (*halfDone)(void));
+void DAC_Clock_Start(uint32_t rate);
@@ -0,0 +1,87 @@
+/**
+ * @file accel.c
+ * @author Maciej Kucharski
+ * @brief Akcelerometr MMA8451Q w trybie FIFO.
+ *
+ * Zamiast odpytywania rejestrów w każdym obiegu pętli czujnik zbiera ACCEL_WMRK
+ * próbek i zgłasza próg FIFO. Jedna transakcja od F_STATUS (0x00) czyta licznik
+ * i całą paczkę - przy F_READ = 0 adres po OUT_Z_LSB wraca do OUT_X_MSB
+ * z kolejną próbką FIFO.
+ */
+
+#include "accel.h"
+#include "i2c.h"
+#include "evlog.h"
+#include "event.h"
+
+#define F_STATUS			0x00
+#define F_SETUP				0x09
+#define XYZ_DATA_CFG	0x0E
+#define CTRL_REG1			0x2A
+#define CTRL_REG4			0x2D
+#define CTRL_REG5			0x2E
+
+#define F_CNT_MASK		0x3F
+#define F_MODE_CIRC		0x40					// FIFO cykliczne - najstarsze próbki nadpisywane
+#define INT_EN_FIFO		0x40
+#define CTRL1_ACTIVE	0x01
+
+static uint8_t rxBuf[1 + 6 * ACCEL_WMRK];	// F_STATUS + XYZ (MSB, LSB) na próbkę
+
+static void accel_done(I2C_Xfer *xfer);
+static I2C_Xfer fifoXfer = { ACCEL_ADDR, F_STATUS, I2C_XFER_REG | I2C_XFER_READ, sizeof(rxBuf), rxBuf, accel_done };
+
+void Accel_Init(void)
+{
+	I2C_Init();
+	I2C_WriteReg(ACCEL_ADDR, CTRL_REG1, 0x00);				// Standby na czas konfiguracji
+	I2C_WriteReg(ACCEL_ADDR, XYZ_DATA_CFG, ACCEL_RANGE);
+	I2C_WriteReg(ACCEL_ADDR, F_SETUP, F_MODE_CIRC | ACCEL_WMRK);
+	I2C_WriteReg(ACCEL_ADDR, CTRL_REG4, INT_EN_FIFO);
+	I2C_WriteReg(ACCEL_ADDR, CTRL_REG5, 0x00);				// Przerwanie FIFO na INT2
+	I2C_WriteReg(ACCEL_ADDR, CTRL_REG1, ACCEL_ODR | CTRL1_ACTIVE);	// F_READ = 0 - pełne 14 bit
+
+	SIM->SCGC5 |= SIM_SCGC5_PORTA_MASK;
+	PORTA->PCR[ACCEL_INT_PIN] |= PORT_PCR_MUX(1) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK | PORT_PCR_IRQC(0xA);	// INT2 aktywne niskim, zbocze opadające
+
+	NVIC_SetPriority(PORTA_IRQn, 3);
+	NVIC_ClearPendingIRQ(PORTA_IRQn);
+	NVIC_EnableIRQ(PORTA_IRQn);
+}
+
+void Accel_Fetch(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();	// Deskryptor nie może trafić do kolejki dwa razy
+	if (fifoXfer.state != I2C_XFER_PENDING)
+		I2C_Submit(&fifoXfer);	// I2C_ERR_FULL - ponowienie w Accel_Poll
+	__set_PRIMASK(primask);
+}
+
+void Accel_Poll(void)
+{
+	// INT2 trzymane w stanie niskim bez odczytu w toku (pełna kolejka I2C, błąd
+	// bez ponowienia) - zbocza już nie będzie, odczyt zlecany stąd
+	if (!(PTA->PDIR & (1 << ACCEL_INT_PIN)))
+		Accel_Fetch();
+}
+
+/**
+ * @brief Koniec odczytu FIFO (przerwanie I2C0) - średnia osi X do kolejki zdarzeń.
+ */
+static void accel_done(I2C_Xfer *xfer)
+{
+	uint8_t n = rxBuf[0] & F_CNT_MASK;
+	int32_t sum = 0;
+	if (xfer->error) n = 0;				// Paczka stracona (NOACK, ARBL, TIMEOUT), INT2 sprawdzane niżej
+	if (n > ACCEL_WMRK) n = ACCEL_WMRK;
+	for (uint8_t i = 0; i < n; i++)
+		sum += (int16_t)((rxBuf[1 + 6 * i] << 8) | rxBuf[2 + 6 * i]) >> 2;
+	if (n) {
+		Event_Post(EVENT_ACCEL, (int16_t)(sum / n));
+		EvLog_Put(EVLOG_ACCEL, (int16_t)(sum / n));
+	}
+	// W FIFO nadal próg (próbka doszła w trakcie odczytu) - INT2 zostaje w stanie niskim, zbocza nie będzie
+	if (!(PTA->PDIR & (1 << ACCEL_INT_PIN)))
+		Accel_Fetch();
+}
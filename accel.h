@@ -0,0 +1,36 @@
+/**
+ * @file accel.h
+ * @author Maciej Kucharski
+ * @brief Akcelerometr MMA8451Q w trybie FIFO - czujnik zbiera próbki sam,
+ *				przerwanie progu FIFO (INT2 -> PTA10) uruchamia jeden odczyt blokowy
+ *				całej paczki w tle (transakcja I2C w przerwaniu). Średnia osi X
+ *				z paczki trafia do kolejki jako EVENT_ACCEL (event.h).
+ */
+
+#ifndef ACCEL_H
+#define ACCEL_H
+
+#include "main.h"
+
+#define ACCEL_ADDR			0x1D					// Adres I2C MMA8451Q
+#define ACCEL_INT_PIN		10						// INT2 czujnika na PTA10
+#define ACCEL_RANGE			0							// XYZ_DATA_CFG: 0 - ±2g (4096 LSB/g)
+#define ACCEL_ODR				0x10					// CTRL_REG1 DR = 010 - 200 Hz
+#define ACCEL_WMRK			4							// Próbek w paczce (próg FIFO): 50 odczytów/s, 14 bit, 4096 = 1g
+
+/**
+ * @brief Konfiguracja czujnika (FIFO, próg, przerwanie na INT2) i pinu PTA10.
+ */
+void Accel_Init(void);
+/**
+ * @brief Zlecenie odczytu paczki z FIFO. Wołane z PORTA_IRQHandler,
+ *				nic nie robi gdy odczyt już trwa.
+ */
+void Accel_Fetch(void);
+/**
+ * @brief Ponowienie odczytu, gdy INT2 jest w stanie niskim, a odczytu nie ma
+ *				(kolejka I2C była pełna). Wołane w każdym obiegu pętli głównej.
+ */
+void Accel_Poll(void);
+
+#endif /* ACCEL_H */
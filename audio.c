@@ -0,0 +1,66 @@
+#include "audio.h"
+#include "synth.h"
+#include "DAC.h"
+#include "prof.h"
+
+// Bufor ping-pong: jedna połowa grana, druga generowana. Dla DMA wyrównany do
+// rozmiaru, bo kanał pracuje w trybie bufora cyklicznego (SMOD).
+static uint16_t audioBuf[2][AUDIO_BLOCK] __attribute__((aligned(2 * AUDIO_BLOCK * sizeof(uint16_t))));
+static volatile uint8_t playBuf = 0;				// Połowa aktualnie wysyłana do DAC
+static volatile uint8_t renderPending = 0;	// Blok czeka na wygenerowanie
+volatile uint32_t audioUnderruns = 0;
+volatile uint32_t audioBlocks = 0;
+#if !AUDIO_USE_DMA
+static uint8_t playPos = 0;									// Pozycja w granej połowie
+#endif
+
+/**
+ * @brief Koniec granej połowy - zamiana połówek i zlecenie generowania zwolnionej.
+ */
+static void audio_swap(void)
+{
+	if (renderPending) audioUnderruns++;	// Poprzedni blok nie zdążył się wygenerować
+	playBuf ^= 0x1;
+	audioBlocks++;
+	renderPending = 1;
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;		// Generowanie zwolnionej połowy w PendSV
+}
+
+void Audio_Init(void)
+{
+	Synth_Render(audioBuf[0], AUDIO_BLOCK);
+	Synth_Render(audioBuf[1], AUDIO_BLOCK);
+
+	NVIC_SetPriority(PendSV_IRQn, AUDIO_PRIO_RENDER);
+#if AUDIO_USE_DMA
+	DAC_Stream_Start(&audioBuf[0][0], 2 * AUDIO_BLOCK, SAMPLE_RATE, audio_swap);
+#else
+	NVIC_SetPriority(TPM0_IRQn, AUDIO_PRIO_SAMPLE);
+	NVIC_ClearPendingIRQ(TPM0_IRQn);
+	NVIC_EnableIRQ(TPM0_IRQn);
+	DAC_Clock_Start(SAMPLE_RATE);
+#endif
+}
+
+#if !AUDIO_USE_DMA
+void TPM0_IRQHandler(void)
+{
+	uint16_t t0 = Prof_Now();
+	TPM0->SC |= TPM_SC_TOF_MASK;	// Przerwanie na każdą próbkę, bez pustych obiegów
+	DAC_Load_Trig(audioBuf[playBuf][playPos]);
+	if (++playPos >= AUDIO_BLOCK)
+	{
+		playPos = 0;
+		audio_swap();
+	}
+	Prof_End(PROF_SAMPLE, t0);
+}
+#endif
+
+void PendSV_Handler(void)
+{
+	uint16_t t0 = Prof_Now();
+	Synth_Render(audioBuf[playBuf ^ 0x1], AUDIO_BLOCK);
+	renderPending = 0;
+	Prof_End(PROF_RENDER, t0);
+}
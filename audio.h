@@ -0,0 +1,32 @@
+/**
+ * @file audio.h
+ * @author Maciej Kucharski
+ * @brief Tor audio - renderowanie blokami do podwójnego bufora (ping-pong).
+ *				Próbki do DAC wysyła DMA taktowane z TPM0 (przerwanie tylko po każdej
+ *				połowie bufora) albo, przy AUDIO_USE_DMA = 0, przerwanie TPM0 na próbkę.
+ *				Blok generowany jest w PendSV o niższym priorytecie.
+ */
+
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include "main.h"
+
+#ifndef AUDIO_USE_DMA
+#define AUDIO_USE_DMA		1										// 1 - strumień DMA + TPM0, 0 - próbka w przerwaniu TPM0
+#endif
+#define AUDIO_BLOCK_SHIFT	5							// Liczba próbek w bloku (połowa bufora) = 2^AUDIO_BLOCK_SHIFT
+#define AUDIO_BLOCK		(1 << AUDIO_BLOCK_SHIFT)
+#define AUDIO_PRIO_SAMPLE	0							// Priorytet przerwania zegara próbkowania
+#define AUDIO_PRIO_RENDER	2							// Priorytet renderowania (PendSV), wyższy niż PORTx/TSI
+
+extern volatile uint32_t audioUnderruns;	// Licznik bloków nie wygenerowanych na czas
+extern volatile uint32_t audioBlocks;			// Zagrane połowy bufora - zegar próbek / AUDIO_BLOCK
+
+/**
+ * @brief Wypełnienie obu buforów i uruchomienie zegara próbkowania.
+ *				Parametry syntezy muszą być ustawione wcześniej.
+ */
+void Audio_Init(void);
+
+#endif /* AUDIO_H */
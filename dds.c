@@ -0,0 +1,48 @@
+#include "dds.h"
+
+// Tablica słów strojenia generowana przez kompilator z NOTE_TABLE i SAMPLE_RATE
+#define DDS_NOTE_TW(f, name, mul)	DDS_TUNING_WORD((f) * (mul), SAMPLE_RATE),
+#define DDS_OCTAVE_ROW(mul)				{ NOTE_TABLE(DDS_NOTE_TW, mul) }
+
+static const uint32_t tuningTable[OCTAVE_COUNT][NOTE_COUNT] = {
+	DDS_OCTAVE_ROW(0.125),	// C1 - C2
+	DDS_OCTAVE_ROW(0.25),
+	DDS_OCTAVE_ROW(0.5),
+	DDS_OCTAVE_ROW(1.0),		// C4 - C5
+	DDS_OCTAVE_ROW(2.0),
+#if OCTAVE_MAX >= 2
+	DDS_OCTAVE_ROW(4.0),
+#endif
+#if OCTAVE_MAX >= 3
+	DDS_OCTAVE_ROW(8.0)			// C7 - C8
+#endif
+};
+
+uint32_t DDS_TuningWord(uint8_t note, int8_t octave)
+{
+	if (note >= NOTE_COUNT) note = NOTE_COUNT - 1;
+	if (octave < OCTAVE_MIN) octave = OCTAVE_MIN;
+	if (octave > OCTAVE_MAX) octave = OCTAVE_MAX;
+	return tuningTable[octave - OCTAVE_MIN][note];
+}
+
+/**
+ * @brief Słowo strojenia dla półtonu liczonego od C najniższej oktawy.
+ */
+static uint32_t dds_semitone(uint8_t semi)
+{
+	uint8_t oct = (uint8_t)((semi * 683u) >> 13);	// semi / 12 bez dzielenia (dokładne do 400)
+	if (oct >= OCTAVE_COUNT)
+		return tuningTable[OCTAVE_COUNT - 1][NOTE_COUNT - 1];	// C na końcu najwyższej oktawy
+	return tuningTable[oct][semi - oct * 12];
+}
+
+uint32_t DDS_PitchWord(uint16_t pitch)
+{
+	if (pitch >= DDS_PITCH_MAX)
+		return dds_semitone(OCTAVE_COUNT * 12);
+	uint8_t semi = pitch >> 8;
+	uint32_t tw0 = dds_semitone(semi);
+	uint32_t tw1 = dds_semitone(semi + 1);
+	return tw0 + ((tw1 - tw0) >> 8) * (pitch & 0xFF);
+}
@@ -0,0 +1,42 @@
+/**
+ * @file dds.h
+ * @author Maciej Kucharski
+ * @brief Generator DDS - 32-bitowy akumulator fazy i słowa strojenia.
+ */
+
+#ifndef DDS_H
+#define DDS_H
+
+#include "main.h"
+
+/**
+ * @brief Słowo strojenia dla częstotliwości f przy próbkowaniu fs: f * 2^32 / fs.
+ *				Przepełnienie akumulatora fazy = jeden okres sygnału. Dla stałych
+ *				argumentów liczone w czasie kompilacji.
+ */
+#define DDS_TUNING_WORD(f, fs)	((uint32_t)((f) * 4294967296.0 / (fs) + 0.5))
+/**
+ * @brief Wysokość dźwięku w dziedzinie logarytmicznej: półtony Q8 względem C
+ *				najniższej oktawy (OCTAVE_MIN). Klawisz (półton) k = wysokość k << 8.
+ */
+#define DDS_PITCH_MAX		((OCTAVE_COUNT * 12) << 8)
+
+/**
+ * @brief Słowo strojenia dla dźwięku i oktawy (odczyt z tablicy w pamięci Flash).
+ *
+ * @param Indeks dźwięku (0 - NOTE_COUNT-1).
+ * @param Oktawa względem C4 (OCTAVE_MIN - OCTAVE_MAX).
+ * @return Przyrost fazy na próbkę.
+ */
+uint32_t DDS_TuningWord(uint8_t note, int8_t octave);
+/**
+ * @brief Słowo strojenia dla wysokości Q8 - interpolacja liniowa między
+ *				sąsiednimi półtonami tablicy (odchyłka od zależności wykładniczej
+ *				najwyżej ok. 0,8 centa w środku półtonu).
+ *
+ * @param Wysokość (półtony Q8, 0 - DDS_PITCH_MAX).
+ * @return Przyrost fazy na próbkę.
+ */
+uint32_t DDS_PitchWord(uint16_t pitch);
+
+#endif /* DDS_H */
@@ -0,0 +1,101 @@
+#include "env.h"
+#include "voice.h"
+#include "audio.h"
+
+#define ENV_BLOCK_RATE	(SAMPLE_RATE / AUDIO_BLOCK)	// Kroki obwiedni na sekundę
+
+// Przyrosty poziomu na blok (Q30), liczone przy zmianie parametru
+static volatile int32_t attackRate = ENV_FULL;
+static volatile int32_t decayRate = ENV_FULL;
+static volatile int32_t releaseRate = ENV_FULL;
+static volatile int32_t sustainLevel = 0x7FFF;		// Q15
+
+/**
+ * @brief Przyrost na blok dla przejścia o pełny zakres w podanym czasie.
+ */
+static int32_t env_rate(uint16_t ms)
+{
+	uint32_t blocks = (uint32_t)ms * ENV_BLOCK_RATE / 1000;
+	if (blocks == 0) blocks = 1;
+	return (int32_t)(ENV_FULL / blocks);
+}
+
+void Env_SetAttack(uint16_t ms)
+{
+	attackRate = env_rate(ms);
+}
+
+void Env_SetDecay(uint16_t ms)
+{
+	decayRate = env_rate(ms);
+}
+
+void Env_SetSustain(uint8_t percent)
+{
+	if (percent > 100) percent = 100;
+	sustainLevel = (int32_t)percent * 0x7FFF / 100;
+}
+
+void Env_SetRelease(uint16_t ms)
+{
+	releaseRate = env_rate(ms);
+}
+
+void Env_Start(uint8_t v)
+{
+	voices.envStage[v] = ENV_ATTACK;
+}
+
+void Env_Release(uint8_t v)
+{
+	if (voices.envStage[v] != ENV_IDLE)
+		voices.envStage[v] = ENV_RELEASE;
+}
+
+void Env_Tick(void)
+{
+	for (uint8_t v = 0; v < VOICE_COUNT; v++)
+	{
+		int32_t level = voices.envLevel[v] + (voices.envStep[v] << AUDIO_BLOCK_SHIFT);	// Poziom na koniec poprzedniego bloku
+		int32_t peak = (int32_t)voices.gain[v] << 15;				// Szczyt Q30 = wzmocnienie głosu
+		int32_t sustain = voices.gain[v] * sustainLevel;		// Q15 * Q15 = Q30
+		int32_t next;
+
+		switch (voices.envStage[v])
+		{
+		case ENV_ATTACK:
+			next = level + attackRate;
+			if (next >= peak)
+			{
+				next = peak;
+				voices.envStage[v] = ENV_DECAY;
+			}
+			break;
+		case ENV_DECAY:
+			next = level - decayRate;
+			if (next <= sustain)
+			{
+				next = sustain;
+				voices.envStage[v] = ENV_SUSTAIN;
+			}
+			break;
+		case ENV_SUSTAIN:
+			next = sustain;				// Nadąża za zmianą poziomu podtrzymania
+			break;
+		case ENV_RELEASE:
+			next = level - releaseRate;
+			if (next <= 0)
+			{
+				next = 0;
+				voices.envStage[v] = ENV_IDLE;
+			}
+			break;
+		default:
+			next = 0;
+			level = 0;
+			break;
+		}
+		voices.envLevel[v] = level;
+		voices.envStep[v] = (next - level) >> AUDIO_BLOCK_SHIFT;
+	}
+}
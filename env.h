@@ -0,0 +1,60 @@
+/**
+ * @file env.h
+ * @author Maciej Kucharski
+ * @brief Obwiednia ADSR głosów - stan liczony raz na blok (częstotliwość
+ *				sterowania), w bloku interpolacja liniowa poziomu co próbkę.
+ *				Tylko dodawanie, porównania i przesunięcia - bez dzielenia i float.
+ */
+
+#ifndef ENV_H
+#define ENV_H
+
+#include "main.h"
+
+#define ENV_FULL			(1L << 30)					// Pełny poziom obwiedni (Q30)
+
+enum { ENV_IDLE, ENV_ATTACK, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE };
+
+/**
+ * @brief Czas narastania.
+ *
+ * @param Czas od zera do szczytu [ms].
+ */
+void Env_SetAttack(uint16_t ms);
+/**
+ * @brief Czas opadania.
+ *
+ * @param Czas od szczytu do zera [ms] (do poziomu podtrzymania proporcjonalnie krócej).
+ */
+void Env_SetDecay(uint16_t ms);
+/**
+ * @brief Poziom podtrzymania.
+ *
+ * @param Poziom względem szczytu (0-100).
+ */
+void Env_SetSustain(uint8_t percent);
+/**
+ * @brief Czas wybrzmiewania.
+ *
+ * @param Czas od szczytu do zera [ms].
+ */
+void Env_SetRelease(uint16_t ms);
+/**
+ * @brief Start obwiedni głosu (od bieżącego poziomu).
+ *
+ * @param Numer głosu.
+ */
+void Env_Start(uint8_t v);
+/**
+ * @brief Przejście głosu do wybrzmiewania.
+ *
+ * @param Numer głosu.
+ */
+void Env_Release(uint8_t v);
+/**
+ * @brief Krok obwiedni wszystkich głosów na początku bloku: poziom docelowy na
+ *				koniec bloku i przyrost na próbkę (różnica >> AUDIO_BLOCK_SHIFT).
+ */
+void Env_Tick(void);
+
+#endif /* ENV_H */
@@ -0,0 +1,38 @@
+#include "event.h"
+
+static Event queue[EVENT_QUEUE_LEN];
+static volatile uint8_t head;				// Zapisuje tylko producent (liczniki wolnobieżne mod 256)
+static volatile uint8_t tail;				// Zapisuje tylko pętla główna
+volatile uint16_t eventsLost;
+
+uint8_t Event_Post(uint8_t type, int16_t value)
+{
+	uint8_t h = head;
+
+	if ((uint8_t)(h - tail) >= EVENT_QUEUE_LEN) {
+		eventsLost++;
+		return 0;
+	}
+	queue[h % EVENT_QUEUE_LEN].type = type;
+	queue[h % EVENT_QUEUE_LEN].value = value;
+	__DMB();										// Treść zapisana przed przesunięciem head
+	head = h + 1;
+	return 1;
+}
+
+uint8_t Event_Pending(void)
+{
+	return head != tail;
+}
+
+uint8_t Event_Get(Event *e)
+{
+	uint8_t t = tail;
+
+	if (t == head) return 0;
+	__DMB();										// head odczytany przed treścią
+	*e = queue[t % EVENT_QUEUE_LEN];
+	__DMB();										// Treść skopiowana przed zwolnieniem miejsca
+	tail = t + 1;
+	return 1;
+}
@@ -0,0 +1,56 @@
+/**
+ * @file event.h
+ * @author Maciej Kucharski
+ * @brief Kolejka zdarzeń z przerwań do pętli głównej (jeden producent,
+ *				jeden odbiorca) bez blokowania przerwań. Producentem są przerwania
+ *				o priorytecie 3: LPTMR0 (przyciski po eliminacji drgań, klaw.c),
+ *				I2C0 (paczka z akcelerometru) i TSI0 (slider). PORTB tylko
+ *				zapamiętuje zbocza i niczego nie wstawia. Przerwania o równym
+ *				priorytecie nie przerywają się nawzajem, więc działają jak jeden
+ *				producent. Indeksy 8 bit zapisuje tylko
+ *				jedna strona, a zapis bajtu na Cortex-M0+ jest niepodzielny,
+ *				LDREX/STREX nie są potrzebne.
+ */
+
+#ifndef EVENT_H
+#define EVENT_H
+
+#include "main.h"
+
+#define EVENT_QUEUE_LEN		16							// Potęga 2, najwyżej 128
+
+enum {
+	EVENT_KEY,													// Naciśnięcie przycisku, value = 1-4 (S1-S4)
+	EVENT_ACCEL,												// Paczka z FIFO akcelerometru, value = średnia osi X
+	EVENT_TSI														// Zmiana pozycji slidera, value = 1-100, 0 - puszczony
+};
+
+typedef struct {
+	uint8_t type;												// EVENT_*
+	int16_t value;
+} Event;
+
+extern volatile uint16_t eventsLost;			// Zdarzenia odrzucone przy pełnej kolejce
+
+/**
+ * @brief Wstawienie zdarzenia - tylko z przerwań o priorytecie 3
+ *				(lub przy wyłączonych przerwaniach).
+ *
+ * @param Typ EVENT_*.
+ * @param Wartość.
+ * @return 1 - wstawione, 0 - kolejka pełna.
+ */
+uint8_t Event_Post(uint8_t type, int16_t value);
+/**
+ * @brief Czy w kolejce są zdarzenia (przed uśpieniem pętli głównej).
+ */
+uint8_t Event_Pending(void);
+/**
+ * @brief Pobranie najstarszego zdarzenia - tylko z pętli głównej.
+ *
+ * @param Miejsce na zdarzenie.
+ * @return 1 - pobrane, 0 - kolejka pusta.
+ */
+uint8_t Event_Get(Event *e);
+
+#endif /* EVENT_H */
@@ -0,0 +1,85 @@
+#include "evlog.h"
+#include "audio.h"
+#include <string.h>
+
+#if EVLOG_ENABLE
+#define EVLOG_MAX	(1 + 5 + 3)								// Najdłuższe zdarzenie: nagłówek, varint czasu, varint 16 bit
+#define EVLOG_DT	31												// Znacznik czasu w dalszym ciągu
+
+EvLog evLog;
+
+static uint32_t lastTime;											// Czas poprzedniego zdarzenia w bloku
+static int16_t lastAccel;											// Wartość poprzedniego EVLOG_ACCEL w bloku
+
+static void evlog_varint(uint32_t v)
+{
+	uint8_t *p = evLog.data[evLog.head];
+	while (v >= 0x80) {
+		p[evLog.pos++] = (uint8_t)v | 0x80;
+		v >>= 7;
+	}
+	p[evLog.pos++] = (uint8_t)v;
+}
+
+/**
+ * @brief Nowy blok z czasem bezwzględnym, na miejscu najstarszego po zapełnieniu.
+ */
+static void evlog_chunk(uint32_t now)
+{
+	uint8_t *p;
+
+	if (evLog.filled) {
+		memset(&evLog.data[evLog.head][evLog.pos], EVLOG_END, EVLOG_CHUNK - evLog.pos);
+		evLog.head = (evLog.head + 1) % EVLOG_CHUNKS;
+	}
+	if (evLog.filled < EVLOG_CHUNKS) evLog.filled++;
+	p = evLog.data[evLog.head];
+	p[0] = (uint8_t)now;
+	p[1] = (uint8_t)(now >> 8);
+	p[2] = (uint8_t)(now >> 16);
+	p[3] = (uint8_t)(now >> 24);
+	evLog.pos = 4;
+	lastTime = now;
+	lastAccel = 0;
+}
+
+void EvLog_Init(void)
+{
+	memset(&evLog, 0, sizeof(evLog));
+	evLog.magic = EVLOG_MAGIC;
+	evLog.rate = SAMPLE_RATE;
+	evLog.tickShift = AUDIO_BLOCK_SHIFT;
+	evLog.chunkSize = EVLOG_CHUNK;
+	evLog.chunks = EVLOG_CHUNKS;
+}
+
+void EvLog_Put(uint8_t type, int16_t value)
+{
+	uint32_t primask = __get_PRIMASK();
+	uint32_t now, dt;
+	uint8_t *p;
+
+	__disable_irq();	// Zapis z LPTMR0/I2C0 (priorytet 3) i z pętli głównej (slider z TSI0)
+	now = audioBlocks;
+	if (!evLog.filled || evLog.pos > EVLOG_CHUNK - EVLOG_MAX)
+		evlog_chunk(now);
+	p = evLog.data[evLog.head];
+	dt = now - lastTime;
+	lastTime = now;
+	if (dt < EVLOG_DT) {
+		p[evLog.pos++] = (uint8_t)(type << 5 | dt);
+	} else {
+		p[evLog.pos++] = (uint8_t)(type << 5 | EVLOG_DT);
+		evlog_varint(dt - EVLOG_DT);
+	}
+	if (type == EVLOG_ACCEL) {
+		int16_t d = value - lastAccel;
+		lastAccel = value;
+		evlog_varint((uint16_t)((uint16_t)d << 1) ^ (uint16_t)(d >> 15));	// zigzag: małe różnice obu znaków w 1 bajcie
+	} else {
+		p[evLog.pos++] = (uint8_t)value;
+	}
+	evLog.events++;
+	__set_PRIMASK(primask);
+}
+#endif
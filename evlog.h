@@ -0,0 +1,74 @@
+/**
+ * @file evlog.h
+ * @author Maciej Kucharski
+ * @brief Rejestr zdarzeń sterowania (oś X, przyciski, slider) w stałym
+ *				buforze RAM, znaczniki czasu z zegara próbek audio. Zapis
+ *				różnicowy, kilka bajtów na zdarzenie - może zostać włączony
+ *				w wersji docelowej. Zrzut evLog z debuggera (binarnie lub HEX)
+ *				odczytuje tools/evlog_decode.py.
+ *
+ *				Bufor to pierścień EVLOG_CHUNKS bloków po EVLOG_CHUNK bajtów.
+ *				Blok zaczyna się czasem bezwzględnym (4 bajty, takty zegara),
+ *				potem zdarzenia:
+ *				  bajt 0: typ (bity 7-5), czas od poprzedniego zdarzenia (bity 4-0,
+ *				          31 - dalszy ciąg w varint), 0x00 - koniec bloku
+ *				  EVLOG_ACCEL:  varint zigzag, różnica od poprzedniej wartości w bloku
+ *				  EVLOG_KEY:    numer przycisku 1-4
+ *				  EVLOG_SLIDER: pozycja 0-100
+ *				Po zapełnieniu nadpisywany jest najstarszy blok, więc każdy blok
+ *				da się odczytać bez poprzednich.
+ */
+
+#ifndef EVLOG_H
+#define EVLOG_H
+
+#include "main.h"
+
+#ifndef EVLOG_ENABLE
+#define EVLOG_ENABLE		1								// 0 - rejestr wyłączony, funkcje puste, bez bufora
+#endif
+#define EVLOG_CHUNKS		8								// Bloki w pierścieniu
+#define EVLOG_CHUNK			64							// Bajty w bloku (4 czas + zdarzenia)
+#define EVLOG_MAGIC			0x314C5645			// "EVL1"
+
+enum {
+	EVLOG_END,													// Reszta bloku pusta
+	EVLOG_ACCEL,												// Średnia paczki z FIFO akcelerometru
+	EVLOG_KEY,													// Naciśnięcie przycisku
+	EVLOG_SLIDER												// Zmiana pozycji slidera (0 - puszczony)
+};
+
+typedef struct {
+	uint32_t magic;											// EVLOG_MAGIC
+	uint32_t rate;											// Częstotliwość próbkowania [Hz]
+	uint32_t events;										// Zapisane od startu (łącznie z nadpisanymi)
+	uint8_t tickShift;									// Takt zegara = 2^tickShift próbek (połowa bufora audio)
+	uint8_t chunkSize;									// EVLOG_CHUNK
+	uint8_t chunks;											// EVLOG_CHUNKS
+	uint8_t head;												// Blok zapisywany
+	uint8_t pos;												// Pozycja zapisu w bloku head
+	uint8_t filled;											// Zapisane bloki (do EVLOG_CHUNKS)
+	uint8_t reserved[2];
+	uint8_t data[EVLOG_CHUNKS][EVLOG_CHUNK];
+} EvLog;
+
+#if EVLOG_ENABLE
+extern EvLog evLog;
+
+/**
+ * @brief Wyczyszczenie rejestru i zapis parametrów dla dekodera.
+ */
+void EvLog_Init(void);
+/**
+ * @brief Zapis zdarzenia. Wołane z przerwań i z pętli głównej.
+ *
+ * @param Typ EVLOG_ACCEL / EVLOG_KEY / EVLOG_SLIDER.
+ * @param Wartość (dla EVLOG_KEY numer przycisku 1-4).
+ */
+void EvLog_Put(uint8_t type, int16_t value);
+#else
+__STATIC_INLINE void EvLog_Init(void) {}
+__STATIC_INLINE void EvLog_Put(uint8_t type, int16_t value) { (void)type; (void)value; }
+#endif
+
+#endif /* EVLOG_H */
@@ -0,0 +1,69 @@
+#include "glide.h"
+#include "audio.h"
+
+#define GLIDE_BLOCK_RATE	(SAMPLE_RATE / AUDIO_BLOCK)	// Kroki przejścia na sekundę
+#define GLIDE_OCTAVE			(12 << 8)										// Oktawa w półtonach Q8
+#define GLIDE_QUANT_RATE	(GLIDE_OCTAVE * 1000 / (GLIDE_QUANT_MS * GLIDE_BLOCK_RATE))
+
+static volatile uint8_t glideMode = GLIDE_OFF;
+static volatile uint16_t target;				// Wysokość docelowa (Q8)
+static volatile uint16_t current;				// Bieżąca wysokość (Q8)
+static volatile uint16_t contRate = 1;	// Krok na blok w trybie GLIDE_CONT (Q8)
+
+/**
+ * @brief Krok na blok dla przejścia o oktawę w podanym czasie (poza torem audio).
+ */
+static uint16_t glide_rate(uint16_t ms)
+{
+	uint32_t blocks = (uint32_t)ms * GLIDE_BLOCK_RATE / 1000;
+	if (blocks == 0) blocks = 1;
+	uint32_t rate = GLIDE_OCTAVE / blocks;
+	return rate ? (uint16_t)rate : 1;
+}
+
+void Glide_SetMode(uint8_t mode)
+{
+	glideMode = mode;
+}
+
+uint8_t Glide_Mode(void)
+{
+	return glideMode;
+}
+
+void Glide_SetTime(uint16_t ms)
+{
+	contRate = glide_rate(ms);
+}
+
+void Glide_SetTarget(uint16_t pitch)
+{
+	if (glideMode == GLIDE_QUANT)
+	{
+		// Zmiana półtonu dopiero po wyjściu poza jego środek o pół półtonu i histerezę
+		int32_t d = (int32_t)pitch - (int32_t)target;
+		if ((d > 128 + GLIDE_HYST) || (d < -(128 + GLIDE_HYST)))
+			target = (uint16_t)((pitch + 128) & ~0xFF);
+	}
+	else
+		target = pitch;
+}
+
+void Glide_Jump(uint16_t pitch)
+{
+	if (glideMode == GLIDE_QUANT)
+		pitch = (uint16_t)((pitch + 128) & ~0xFF);
+	target = pitch;
+	current = pitch;
+}
+
+uint16_t Glide_Tick(void)
+{
+	int32_t rate = (glideMode == GLIDE_QUANT) ? GLIDE_QUANT_RATE : contRate;
+	int32_t d = (int32_t)target - (int32_t)current;
+
+	if (d > rate) current += rate;
+	else if (d < -rate) current -= rate;
+	else current = target;
+	return current;
+}
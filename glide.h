@@ -0,0 +1,58 @@
+/**
+ * @file glide.h
+ * @author Maciej Kucharski
+ * @brief Portamento - płynne przejście wysokości dźwięku w dziedzinie
+ *				logarytmicznej (półtony Q8), krok raz na blok audio, tylko liczby całkowite.
+ */
+
+#ifndef GLIDE_H
+#define GLIDE_H
+
+#include "main.h"
+
+enum {
+	GLIDE_OFF,			// Każdy półton to nowa nuta (bez przejścia)
+	GLIDE_QUANT,		// Wysokość przyciągana do półtonów, krótkie przejście między nimi
+	GLIDE_CONT			// Wysokość ciągła, przejście ze stałą szybkością
+};
+
+#define GLIDE_QUANT_MS		40							// Czas przejścia o oktawę w trybie GLIDE_QUANT [ms]
+#define GLIDE_HYST				40							// Histereza przyciągania do półtonu (Q8, ok. 0,16 półtonu)
+
+/**
+ * @brief Wybór trybu.
+ *
+ * @param GLIDE_OFF, GLIDE_QUANT lub GLIDE_CONT.
+ */
+void Glide_SetMode(uint8_t mode);
+/**
+ * @brief Tryb pracy.
+ */
+uint8_t Glide_Mode(void);
+/**
+ * @brief Szybkość przejścia w trybie GLIDE_CONT.
+ *
+ * @param Czas przejścia o oktawę [ms].
+ */
+void Glide_SetTime(uint16_t ms);
+/**
+ * @brief Wysokość docelowa (z pętli sterowania). W trybie GLIDE_QUANT
+ *				zaokrąglana do półtonu z histerezą.
+ *
+ * @param Wysokość (półtony Q8).
+ */
+void Glide_SetTarget(uint16_t pitch);
+/**
+ * @brief Ustawienie wysokości bez przejścia (początek nuty).
+ *
+ * @param Wysokość (półtony Q8).
+ */
+void Glide_Jump(uint16_t pitch);
+/**
+ * @brief Krok przejścia - wywoływany raz na blok audio.
+ *
+ * @return Bieżąca wysokość (półtony Q8).
+ */
+uint16_t Glide_Tick(void);
+
+#endif /* GLIDE_H */
@@ -0,0 +1,33 @@
+/**
+ * @file hal.h
+ * @author Maciej Kucharski
+ * @brief Granica sprzętu. Rejestry dotykają tylko sterowniki za nagłówkami
+ *				DAC.h, i2c.h i tsi.h oraz procedury przerwań - na płytce są to pliki
+ *				z katalogu głównego, na PC (make sim) ich odpowiedniki z sim/
+ *				z wirtualnymi MMA8451Q, PCF8574/HD44780, TSI i przechwytywaniem DAC.
+ *				Reszta (synteza, LCD, akcelerometr, aplikacja) kompiluje się bez zmian.
+ */
+
+#ifndef HAL_H
+#define HAL_H
+
+#include "MKL05Z4.h"
+
+/**
+ * @brief Inicjalizacja sprzętu i silnika (main.c).
+ */
+void App_Init(void);
+/**
+ * @brief Jeden obieg pętli głównej (main.c).
+ */
+void App_Poll(void);
+
+// Procedury obsługi przerwań - na płytce z tablicy wektorów, w symulatorze wołane przez sim/
+void PORTA_IRQHandler(void);
+void PORTB_IRQHandler(void);
+void LPTMR0_IRQHandler(void);
+void TPM0_IRQHandler(void);
+void PendSV_Handler(void);
+void SysTick_Handler(void);
+
+#endif /* HAL_H */
@@ -7,16 +7,34 @@
  * @author Koryciak & Sokolowski
  * @date Apr 2021
  * @brief File containing definitions for I2C.
- * @ver 1.0
+ * @ver 1.2
+ *
+ * Transfers are executed by a state machine in I2C0_IRQHandler, one interrupt
+ * per byte. Blocking functions only build a descriptor and wait for it.
+ * A queued transfer starts only on an idle bus: if the STOP of the previous
+ * one is still in progress, it waits for the stop detect interrupt (or
+ * I2C_Poll from the main loop) instead of polling BUSY inside the interrupt.
  */
 
 #include "i2c.h"
+#include "prof.h"
 
 /******************************************************************************\
 * Private definitions
 \******************************************************************************/
 #define SCL   3
 #define SDA   4
+
+#define I2C_WAIT_LOOPS	10000			/* blocking wait without bus activity = timeout */
+#define I2C_IDLE_POLLS	10				/* I2C_Poll calls with bus BUSY before starting anyway */
+
+enum {
+	PH_ADDR_W,											/* write address sent */
+	PH_REG,													/* register sent */
+	PH_DATA_W,											/* data byte sent */
+	PH_ADDR_R,											/* read address sent */
+	PH_DATA_R												/* data byte received */
+};
 /******************************************************************************\
 * Private prototypes
 \******************************************************************************/
@@ -26,18 +44,27 @@ void i2c_m_rstart(void);
 void i2c_tran(void);
 void i2c_rec(void);
 void i2c_enable(void);
-void i2c_disable(void);
 void i2c_send(uint8_t);
 uint8_t i2c_recv(void);
-void i2c_wait(void);
 void i2c_nack(void);
 void i2c_ack(void);
 void i2c_clr_IICIF(void);
+static void i2c_start(I2C_Xfer *xfer);
+static void i2c_finish(uint8_t err);
+static void i2c_next(uint8_t force);
+static uint8_t i2c_sync(I2C_Xfer *xfer);
+static void i2c_step(void);
 /******************************************************************************\
 * Private memory declarations
 \******************************************************************************/
-static uint8_t error;
-static uint16_t timeout;
+static I2C_Xfer *queue[I2C_QUEUE_LEN];
+static uint8_t qHead, qTail, qCount;
+static I2C_Xfer * volatile cur;			/* transfer on the bus */
+static uint8_t phase;
+static uint8_t idx;
+static volatile uint8_t progress;		/* incremented on every interrupt */
+static volatile uint8_t idleWait;		/* queue head waits for STOP on the bus */
+static uint8_t idlePolls;
 volatile uint8_t dummy;
 
 void I2C_Init(void) {	
@@ -47,151 +74,282 @@ SIM->SCGC5 |= SIM_SCGC5_PORTB_MASK;		/* clock for PORTB */
 PORTB->PCR[SCL] |= PORT_PCR_MUX(2); 	/* I2C0 SCL	(PTB3) */
 PORTB->PCR[SDA] |= PORT_PCR_MUX(2); 	/* I2C0 SDA	(PTB4) */
 	
+if (cur) return;												/* already running, keep queue */
 I2C0->C1 &= ~(I2C_C1_IICEN_MASK);			/* disable module during modyfications*/
 I2C0->F  |= I2C_F_MULT(0x01);					/* MULT = 0,1,2 */
 I2C0->F  |= I2C_F_ICR(0x01);					/* SCLdivider = Table 36-28. I2C divider and hold values. Reference Manual p.622 */
+I2C0->C1 |= I2C_C1_IICIE_MASK;				/* interrupt per byte */
+I2C0->FLT |= I2C_FLT_STOPIE_MASK;			/* and on STOP, resumes queue waiting for idle bus */
+i2c_enable();
+
+NVIC_SetPriority(I2C0_IRQn, I2C_PRIO);
+NVIC_ClearPendingIRQ(I2C0_IRQn);
+NVIC_EnableIRQ(I2C0_IRQn);
 }
 
-uint8_t I2C_Ping(uint8_t address) {
+uint8_t I2C_Submit(I2C_Xfer *xfer) {
 	
-	error = 0x00;
+	uint32_t primask = __get_PRIMASK();
+	uint8_t err = 0;
 	
-	i2c_enable();
-	i2c_tran();															/* set to transmit mode */
-	i2c_m_start();													/* send start */
-	i2c_send((uint8_t)(address << 1));  		/* send write address */
-	i2c_wait();															/* wait for ack from slave */
-	i2c_m_stop();														/* clear start mask */
-	i2c_disable();
+	__disable_irq();
+	if (qCount >= I2C_QUEUE_LEN) {
+		err = I2C_ERR_FULL;
+	} else {
+		xfer->error = 0;
+		xfer->state = I2C_XFER_PENDING;
+		queue[qTail] = xfer;
+		qTail = (qTail + 1) % I2C_QUEUE_LEN;
+		qCount++;
+		if (!cur && !idleWait) i2c_next(0);
+	}
+	__set_PRIMASK(primask);
 	
-	return error;
+	return err;
+}
+
+uint8_t I2C_Busy(void) {
+	return (cur != 0) || (qCount != 0);
+}
+
+void I2C_Poll(void) {
+	
+	uint32_t primask = __get_PRIMASK();
+	
+	__disable_irq();
+	if (!cur && qCount) i2c_next(++idlePolls >= I2C_IDLE_POLLS);	/* stop detect missed or bus held */
+	__set_PRIMASK(primask);
+}
+
+uint8_t I2C_Ping(uint8_t address) {
+	
+	I2C_Xfer x = { 0 };
+	
+	x.address = address;
+	return i2c_sync(&x);
 }
 
 uint8_t I2C_Write(uint8_t address, uint8_t data) {
 	
-	error = 0x00;
+	I2C_Xfer x = { 0 };
 	
-	i2c_enable();
-	i2c_tran();															/* set to transmit mode */
-	i2c_m_start();													/* send start */
-	i2c_send((uint8_t)(address << 1));  		/* send write address */
-	i2c_wait();															/* wait for ack from slave */
-	i2c_send(data);													/* send data */
-	i2c_wait();
-	i2c_m_stop();														/* clear start mask */
-	i2c_disable();
+	x.address = address;
+	x.size = 1;
+	x.data = &data;
+	return i2c_sync(&x);
+}
+
+uint8_t I2C_WriteBlock(uint8_t address, uint8_t size, uint8_t* data) {
 	
-	return error;
+	I2C_Xfer x = { 0 };
+	
+	x.address = address;
+	x.size = size;
+	x.data = data;
+	return i2c_sync(&x);
 }
 
 uint8_t I2C_Read(uint8_t address, uint8_t* data) {
 	
-	error = 0x00;
+	I2C_Xfer x = { 0 };
 	
-	i2c_enable();
-	i2c_tran();															/* set to transmit mode */
-	i2c_m_start();													/* send start */
-	i2c_send((uint8_t)(address << 1)|0x01); /* send read address */
-	i2c_wait();															/* wait for ack from slave */
-	i2c_rec();															/* set to receive mode */
-	i2c_nack();
-	dummy = i2c_recv();										  /* read data */
-	i2c_wait();
-	i2c_m_stop();														/* clear start mask */
-	(*data) = i2c_recv();
-	i2c_disable();
-	
-	return error;
+	x.address = address;
+	x.flags = I2C_XFER_READ;
+	x.size = 1;
+	x.data = data;
+	return i2c_sync(&x);
 }
 
 uint8_t I2C_WriteReg(uint8_t address, uint8_t reg, uint8_t data) {
 	
-	error = 0x00;
+	I2C_Xfer x = { 0 };
 	
-	i2c_enable();
-	i2c_tran();															/* set to transmit mode */
-	i2c_m_start();													/* send start */
-	i2c_send((uint8_t)(address << 1));  		/* send write address */
-	i2c_wait();															/* wait for ack from slave */
-	i2c_send(reg);													/* select register */
-	i2c_wait();
-	i2c_send(data);													/* send data */
-	i2c_wait();
-	i2c_m_stop();														/* clear start mask */
-	i2c_disable();
-	
-	return error;
+	x.address = address;
+	x.reg = reg;
+	x.flags = I2C_XFER_REG;
+	x.size = 1;
+	x.data = &data;
+	return i2c_sync(&x);
 }
 
 uint8_t I2C_ReadReg(uint8_t address, uint8_t reg, uint8_t* data) {
 	
-	error = 0x00;
-	
-	i2c_enable();
-	i2c_clr_IICIF();
-	i2c_tran();															/* set to transmit mode */
-	i2c_m_start();													/* send start */
-	i2c_send((uint8_t)(address << 1));      /* send write address */
-	i2c_wait();															/* wait for ack from slave */
-	i2c_send(reg);													/* select register */
-	i2c_wait();
-	
-	i2c_m_rstart();
+	return I2C_ReadRegBlock(address, reg, 1, data);
+}
 
-	i2c_send((uint8_t)(address << 1)|0x01); /* send read address */
-	i2c_wait();
+uint8_t I2C_ReadRegBlock(uint8_t address, uint8_t reg, uint8_t size, uint8_t* data) {
 	
-	i2c_rec();															/* set to receive mode */
-	i2c_nack();															/* no acknowledge bit */
-	dummy = i2c_recv();										  /* read data */
-	i2c_wait();
-	i2c_m_stop();														/* clear start mask */
-	(*data) = i2c_recv();
+	I2C_Xfer x = { 0 };
 	
-	i2c_disable();
+	x.address = address;
+	x.reg = reg;
+	x.flags = I2C_XFER_REG | I2C_XFER_READ;
+	x.size = size;
+	x.data = data;
+	return i2c_sync(&x);
+}
+/**
+ * @brief I2C0 interrupt.
+ */
+void I2C0_IRQHandler(void) {
+	
+	uint16_t t0 = Prof_Now();
 	
-	return error;
+	i2c_step();
+	Prof_End(PROF_I2C, t0);
 }
-
-uint8_t I2C_ReadRegBlock(uint8_t address, uint8_t reg, uint8_t size, uint8_t* data) {
+/**
+ * @brief One step of the active transfer.
+ */
+static void i2c_step(void) {
 	
-	error = 0x00;
-	uint8_t cnt = 0;
+	I2C_Xfer *x = cur;
+	uint8_t s = I2C0->S;
 	
-	i2c_enable();
 	i2c_clr_IICIF();
+	progress++;
+	if (I2C0->FLT & I2C_FLT_STOPF_MASK) {
+		I2C0->FLT |= I2C_FLT_STOPF_MASK;
+		if (!x) {																/* bus idle after our STOP */
+			if (qCount) i2c_next(0);
+			return;
+		}
+	}
+	if (!x) return;
+	
+	if (s & I2C_S_ARBL_MASK) {
+		I2C0->S |= I2C_S_ARBL_MASK;
+		i2c_finish(I2C_ERR_ARBL);
+		return;
+	}
+	if (phase != PH_DATA_R && (s & I2C_S_RXAK_MASK)) {
+		i2c_finish(I2C_ERR_NOACK);						/* address, register or data not acknowledged */
+		return;
+	}
+	
+	switch (phase) {
+	case PH_ADDR_W:
+		if (x->flags & I2C_XFER_REG) {
+			phase = PH_REG;
+			i2c_send(x->reg);										/* select register */
+			return;
+		}
+		/* fall through - plain write */
+	case PH_REG:
+		if (x->flags & I2C_XFER_READ) {
+			phase = PH_ADDR_R;
+			i2c_m_rstart();
+			i2c_send((uint8_t)(x->address << 1)|0x01);	/* send read address */
+			return;
+		}
+		/* fall through - first data byte */
+	case PH_DATA_W:
+		phase = PH_DATA_W;
+		if (idx < x->size) i2c_send(x->data[idx++]);
+		else i2c_finish(0);
+		return;
+	case PH_ADDR_R:
+		if (x->size == 0) {
+			i2c_finish(0);
+			return;
+		}
+		phase = PH_DATA_R;
+		i2c_rec();														/* set to receive mode */
+		if (x->size == 1) i2c_nack();					/* no acknowledge bit for last byte */
+		else i2c_ack();
+		dummy = i2c_recv();										/* start first read */
+		return;
+	case PH_DATA_R:
+		if (idx == x->size - 1) {
+			i2c_m_stop();												/* stop before reading last byte */
+			x->data[idx++] = i2c_recv();
+			i2c_finish(0);
+		} else {
+			if (idx == x->size - 2) i2c_nack();
+			x->data[idx++] = i2c_recv();
+		}
+		return;
+	}
+}
+/**
+ * @brief Put transfer on the bus: START and first address byte.
+ */
+static void i2c_start(I2C_Xfer *xfer) {
+	
+	cur = xfer;
+	idx = 0;
+	I2C0->FLT |= I2C_FLT_STOPF_MASK;				/* STOP of previous transfer already seen */
+	i2c_clr_IICIF();
+	NVIC_ClearPendingIRQ(I2C0_IRQn);
+	i2c_ack();
 	i2c_tran();															/* set to transmit mode */
 	i2c_m_start();													/* send start */
-	i2c_send((uint8_t)(address << 1));      /* send write address */
-	i2c_wait();															/* wait for ack from slave */
-	i2c_send(reg);													/* select register */
-	i2c_wait();
+	if ((xfer->flags & (I2C_XFER_REG | I2C_XFER_READ)) == I2C_XFER_READ) {
+		phase = PH_ADDR_R;
+		i2c_send((uint8_t)(xfer->address << 1)|0x01); /* send read address */
+	} else {
+		phase = PH_ADDR_W;
+		i2c_send((uint8_t)(xfer->address << 1));  		/* send write address */
+	}
+}
+/**
+ * @brief Release the bus, report result and start next queued transfer.
+ */
+static void i2c_finish(uint8_t err) {
 	
-	i2c_m_rstart();
-
-	i2c_send((uint8_t)(address << 1)|0x01); /* send read address */
-	i2c_wait();
+	I2C_Xfer *x = cur;
 	
-	i2c_rec();															/* set to receive mode */
+	i2c_m_stop();														/* clear start mask */
+	i2c_tran();
+	cur = 0;
+	if (qCount) i2c_next(0);								/* next one first, callback may submit more */
+	x->error = err;
+	x->state = I2C_XFER_DONE;
+	if (x->callback) x->callback(x);
+}
+/**
+ * @brief Start queue head if the bus is idle, otherwise wait for STOP.
+ *
+ * @param Start even if BUSY is still set.
+ */
+static void i2c_next(uint8_t force) {
 	
-	i2c_ack();														/* transmit acknowledge bit */
-	dummy = i2c_recv();										/* read data */
+	I2C_Xfer *next;
 	
-	while(cnt < (size-2)) {
-		i2c_wait();	
-		data[cnt++] = i2c_recv();
+	if (!force && (I2C0->S & I2C_S_BUSY_MASK)) {
+		idleWait = 1;													/* stop detect or I2C_Poll resumes */
+		return;
 	}
-	i2c_nack();	/* no acknowledge bit */
-	i2c_wait();
-	data[cnt++] = i2c_recv();
-															
-	i2c_wait();
-	i2c_m_stop();														/* set start mask off */	
-	data[cnt] = i2c_recv();
-
-	i2c_disable();
+	idleWait = 0;
+	idlePolls = 0;
+	next = queue[qHead];
+	qHead = (qHead + 1) % I2C_QUEUE_LEN;
+	qCount--;
+	i2c_start(next);
+}
+/**
+ * @brief Submit and wait. Only for main loop - I2C0 interrupt must be able to run.
+ */
+static uint8_t i2c_sync(I2C_Xfer *xfer) {
 	
-	return error;
+	uint16_t timeout = 0;
+	uint8_t seen = progress;
+	uint8_t err = I2C_Submit(xfer);
+	
+	if (err) return err;
+	while (xfer->state != I2C_XFER_DONE) {
+		if (progress != seen) {
+			seen = progress;
+			timeout = 0;
+		} else if (++timeout >= I2C_WAIT_LOOPS) {
+			__disable_irq();
+			if (cur && progress == seen) i2c_finish(I2C_ERR_TIMEOUT);	/* bus stuck, drop active transfer */
+			else if (!cur && qCount) i2c_next(1);		/* still BUSY, start anyway */
+			__enable_irq();
+			timeout = 0;
+		}
+	}
+	return xfer->error;
 }
 /**
  * @brief I2C master start.
@@ -234,12 +392,6 @@ void i2c_rec(void) {
 void i2c_enable(void) {
   I2C0->C1 |= I2C_C1_IICEN_MASK;
 }
-/**
- * @brief I2C disable.
- */
-void i2c_disable(void) {
-  I2C0->C1 &= ~I2C_C1_IICEN_MASK;
-}
 /**
  * @brief I2C send data.
  */
@@ -252,17 +404,6 @@ void i2c_send(uint8_t data) {
 uint8_t i2c_recv(void) {
 	return I2C0->D;
 }
-/**
- * @brief I2C wait.
- */
-void i2c_wait(void) {
-  timeout = 0;
-	
-  while ((((I2C0->S & I2C_S_IICIF_MASK)==0)||((I2C0->S & I2C_S_TCF_MASK)==0)) && (timeout<10000)) timeout++;
-  if (timeout >= 10000) 						  error |= I2C_ERR_TIMEOUT; 
-	if ((I2C0->S & I2C_S_RXAK_MASK)==1) error |= I2C_ERR_NOACK;
-	i2c_clr_IICIF();
-}
 /**
  * @brief I2C transmit no acknowledge bit.
  */
@@ -7,7 +7,7 @@
  * @author Koryciak & Sokołowski
  * @date Apr 2021
  * @brief File containing enums, structures and declarations for I2C.
- * @ver 0.5
+ * @ver 0.7
  */
 
 #ifndef I2C_H
@@ -20,10 +20,58 @@
 \******************************************************************************/
 #define I2C_ERR_TIMEOUT		0x01 		/* error = timeout */
 #define I2C_ERR_NOACK			0x02 		/* error = no ACK from slave  */
+#define I2C_ERR_ARBL			0x04 		/* error = arbitration lost */
+#define I2C_ERR_FULL			0x08 		/* error = transfer queue full */
+
+#define I2C_QUEUE_LEN			8				/* transfers waiting behind the active one */
+#define I2C_PRIO					3				/* I2C0 interrupt priority */
+
+#define I2C_XFER_REG			0x01		/* send register address after slave address */
+#define I2C_XFER_READ			0x02		/* read data (after repeated start if I2C_XFER_REG) */
+
+enum I2C_XferState {
+	I2C_XFER_IDLE,									/* never submitted or result consumed by caller */
+	I2C_XFER_PENDING,								/* queued or on the bus */
+	I2C_XFER_DONE										/* finished, see error field */
+};
+/**
+ * @brief I2C transfer descriptor. Owned by the caller, must stay valid
+ *				until state becomes I2C_XFER_DONE.
+ */
+typedef struct I2C_Xfer {
+	uint8_t address;								/* 7-bit slave address */
+	uint8_t reg;										/* register, used with I2C_XFER_REG */
+	uint8_t flags;									/* I2C_XFER_REG | I2C_XFER_READ */
+	uint8_t size;										/* data bytes, 0 = address only (ping) */
+	uint8_t *data;									/* data to write or buffer for read */
+	void (*callback)(struct I2C_Xfer *xfer);	/* called from I2C0 IRQ when done, may be 0 */
+	volatile uint8_t state;					/* enum I2C_XferState */
+	volatile uint8_t error;					/* I2C_ERR_* flags */
+} I2C_Xfer;
 /**
  * @brief I2C initialization.
  */
 void I2C_Init(void);
+/**
+ * @brief Queue transfer, returns immediately. Transfers run in submission order
+ *				from I2C0 interrupt. Safe to call from main loop and interrupts.
+ *
+ * @param Transfer descriptor.
+ * @return 0 or I2C_ERR_FULL.
+ */
+uint8_t I2C_Submit(I2C_Xfer *xfer);
+/**
+ * @brief Check if any transfer is queued or on the bus.
+ *
+ * @return TRUE when busy.
+ */
+uint8_t I2C_Busy(void);
+/**
+ * @brief Main loop backstop: start a queued transfer if the bus went idle
+ *				without a stop detect interrupt, after I2C_IDLE_POLLS calls even if
+ *				BUSY is still set.
+ */
+void I2C_Poll(void);
 /**
  * @brief Send via I2C only device address (write). In response check error type.
  *
@@ -40,6 +88,17 @@ uint8_t I2C_Ping(uint8_t address);
  * @return Errors.
  */
 uint8_t I2C_Write(uint8_t address, uint8_t data);
+/**
+ * @brief I2C block write. Write bytes to specified device address in one
+ *				transaction (start, address, data..., stop).
+ *				Works best with I/O expanders driving parallel buses.
+ *
+ * @param Address of slave.
+ * @param Count of bytes to write.
+ * @param Data to write.
+ * @return Errors.
+ */
+uint8_t I2C_WriteBlock(uint8_t address, uint8_t size, uint8_t* data);
 /**
  * @brief I2C basic read operation. Read 8 bits from specified device address.
  *				Works best with I/O expanders.
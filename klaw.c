@@ -1,23 +1,91 @@
 #include "klaw.h"
+#include "event.h"
+#include "evlog.h"
+#include "prof.h"
+
+static const uint32_t keyMask[4] = { S1_MASK, S2_MASK, S3_MASK, S4_MASK };
+static volatile uint32_t keyActive;		// Klawisze po zboczu lub wcisniete - probkowane co takt
+static uint8_t keyLevel[4];						// Integrator 0..KLAW_DEBOUNCE, KLAW_DEBOUNCE = wcisniety
+static uint8_t keyDown;								// Stan po eliminacji drgan, bit na klawisz
+static uint16_t keyHeld[4];						// Takty od wcisniecia
 
 void Klaw_Init(void)
 {
-	SIM->SCGC5 |= SIM_SCGC5_PORTA_MASK;		// Wlaczenie portu A
-	PORTA->PCR[S1] |= PORT_PCR_MUX(1);
-	PORTA->PCR[S2] |= PORT_PCR_MUX(1);
-	PORTA->PCR[S3] |= PORT_PCR_MUX(1);
-	PORTA->PCR[S4] |= PORT_PCR_MUX(1);
-	PORTA->PCR[S1] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
-	PORTA->PCR[S2] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
-	PORTA->PCR[S3] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
-	PORTA->PCR[S4] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+	SIM->SCGC5 |= SIM_SCGC5_PORTB_MASK;		// Wlaczenie portu B
+	PORTB->PCR[S1] |= PORT_PCR_MUX(1);
+	PORTB->PCR[S2] |= PORT_PCR_MUX(1);
+	PORTB->PCR[S3] |= PORT_PCR_MUX(1);
+	PORTB->PCR[S4] |= PORT_PCR_MUX(1);
+	PORTB->PCR[S1] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+	PORTB->PCR[S2] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+	PORTB->PCR[S3] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+	PORTB->PCR[S4] |= PORT_PCR_PE_MASK | PORT_PCR_PS_MASK;
+}
+void Klaw_Int(void)
+{
+	PORTB -> PCR[S1] |= PORT_PCR_IRQC(0xa);		//0x8 - poziom "0"; 0x9 - zbocze narastające; 0xa - zbocze opadające; 0xb - obydwa zbocza
+	PORTB -> PCR[S2] |= PORT_PCR_IRQC(0xa);
+	PORTB -> PCR[S3] |= PORT_PCR_IRQC(0xa);		
+	PORTB -> PCR[S4] |= PORT_PCR_IRQC(0xa);
+	NVIC_SetPriority(PORTB_IRQn, KLAW_PRIO); 
+	NVIC_ClearPendingIRQ(PORTB_IRQn);
+	NVIC_EnableIRQ(PORTB_IRQn);
+}
+void Klaw_Tick_Init(void)
+{
+	SIM->SCGC5 |= SIM_SCGC5_LPTMR_MASK;
+	LPTMR0->CSR = 0;
+	LPTMR0->PSR = LPTMR_PSR_PCS(1) | LPTMR_PSR_PBYP_MASK;	// LPO 1 kHz bez preskalera
+	LPTMR0->CMR = 0;											// Porownanie co takt
+	LPTMR0->CSR = LPTMR_CSR_TCF_MASK | LPTMR_CSR_TIE_MASK | LPTMR_CSR_TEN_MASK;	// Licznik ciagle - wyzwala tez skany TSI
+	NVIC_SetPriority(LPTMR0_IRQn, KLAW_PRIO);
+	NVIC_ClearPendingIRQ(LPTMR0_IRQn);
+	NVIC_EnableIRQ(LPTMR0_IRQn);
+}
+void Klaw_Edge(uint32_t mask)
+{
+	keyActive |= mask;
+}
+static void klaw_press(uint8_t key)
+{
+	Event_Post(EVENT_KEY, key);
+	EvLog_Put(EVLOG_KEY, key);
 }
-void Klaw_S2_4_Int(void)
+/**
+ * @brief Takt 1 ms - skasowanie TCF (nastepne porownanie i skan TSI),
+ *				integrator na klawisz, wcisniecie i autopowtarzanie.
+ */
+void LPTMR0_IRQHandler(void)
 {
-	PORTA -> PCR[S2] |= PORT_PCR_IRQC(0xa);		//0x8 - poziom "0"; 0x9 - zbocze narastające; 0xa - zbocze opadające; 0xb - obydwa zbocza
-	PORTA -> PCR[S3] |= PORT_PCR_IRQC(0xa);		
-	PORTA -> PCR[S4] |= PORT_PCR_IRQC(0xa);
-	NVIC_SetPriority(PORTA_IRQn, 3); 
-	NVIC_ClearPendingIRQ(PORTA_IRQn);
-	NVIC_EnableIRQ(PORTA_IRQn);
+	uint16_t t0;
+	uint32_t pressed;
+	
+	LPTMR0->CSR |= LPTMR_CSR_TCF_MASK;
+	if (!keyActive) return;								// Spoczynek - bez pomiaru, co takt
+	t0 = Prof_Now();
+	pressed = ~PTB->PDIR & keyActive;			// Wcisniety = stan niski
+	for (uint8_t i = 0; i < 4; i++) {
+		uint32_t mask = keyMask[i];
+		if (!(keyActive & mask)) continue;
+		if (pressed & mask) {
+			if (keyLevel[i] < KLAW_DEBOUNCE) keyLevel[i]++;
+		} else if (keyLevel[i]) {
+			keyLevel[i]--;
+		}
+		if (keyDown & (1 << i)) {
+			if (keyLevel[i] == 0) {
+				keyDown &= ~(1 << i);						// Zwolniony
+			} else if (++keyHeld[i] >= KLAW_HOLD && (KLAW_REPEAT_KEYS & mask)) {
+				keyHeld[i] -= KLAW_REPEAT;
+				klaw_press(i + 1);
+			}
+		} else if (keyLevel[i] == KLAW_DEBOUNCE) {
+			keyDown |= 1 << i;
+			keyHeld[i] = 0;
+			klaw_press(i + 1);
+		}
+		if (keyLevel[i] == 0 && !(keyDown & (1 << i)))
+			keyActive &= ~mask;								// Spoczynek - do nastepnego zbocza
+	}
+	Prof_End(PROF_KLAW, t0);
 }
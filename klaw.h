@@ -2,16 +2,59 @@
 #define KLAW_H
 
 #include "MKL05Z4.h"
-#define S1_MASK	(1<<9)		// Maska dla klawisza S1
-#define S2_MASK	(1<<10)		// Maska dla klawisza S2
-#define S3_MASK	(1<<11)		// Maska dla klawisza S3
-#define S4_MASK	(1<<12)		// Maska dla klawisza S4
-#define S1	9							// Numer bitu dla klawisza S1
-#define S2	10						// Numer bitu dla klawisza S2
-#define S3	11						// Numer bitu dla klawisza S3
-#define S4	12						// Numer bitu dla klawisza S4
+// Przyciski na porcie B, zwieraja do masy (polaczenia - README.md). Zajete:
+// PTB1 wyjscie DAC0, PTB3/PTB4 I2C, PTB5 NMI, PTB8-PTB10 dioda RGB, PTB11
+// wyjscie GPIO (DAC.c), PTB12 kanal TSI 8 (tsi.c) - piny klawiszy musza byc inne.
+// Inne polaczenie: opcja kompilatora -DKLAW_S1_PIN=... (tak samo S2-S4).
+#ifndef KLAW_S1_PIN
+#define KLAW_S1_PIN	7				// Numer pinu PTB dla klawisza S1
+#endif
+#ifndef KLAW_S2_PIN
+#define KLAW_S2_PIN	0				// Numer pinu PTB dla klawisza S2
+#endif
+#ifndef KLAW_S3_PIN
+#define KLAW_S3_PIN	2				// Numer pinu PTB dla klawisza S3
+#endif
+#ifndef KLAW_S4_PIN
+#define KLAW_S4_PIN	6				// Numer pinu PTB dla klawisza S4
+#endif
+#define S1	KLAW_S1_PIN
+#define S2	KLAW_S2_PIN
+#define S3	KLAW_S3_PIN
+#define S4	KLAW_S4_PIN
+#define S1_MASK	(1<<S1)		// Maska dla klawisza S1
+#define S2_MASK	(1<<S2)		// Maska dla klawisza S2
+#define S3_MASK	(1<<S3)		// Maska dla klawisza S3
+#define S4_MASK	(1<<S4)		// Maska dla klawisza S4
 
+// Eliminacja drgan stykow taktem LPTMR (LPO 1 kHz, 1 takt = 1 ms). LPTMR liczy
+// ciagle, bo wyzwala tez skany elektrod TSI (tsi.c). Przerwanie co takt kasuje
+// TCF - przy TFC = 0 licznik stoi, dopoki TCF jest ustawione, a z nim skany TSI.
+// Probkowanie klawiszy tylko po zboczu.
+#define KLAW_DEBOUNCE	8						// Takty zgodnego stanu do zmiany (integrator)
+#define KLAW_HOLD			500					// Takty przytrzymania do pierwszego powtorzenia
+#define KLAW_REPEAT		150					// Takty miedzy powtorzeniami
+#define KLAW_REPEAT_KEYS	(S2_MASK | S3_MASK)	// Klawisze z autopowtarzaniem (oktawa)
+#define KLAW_PRIO			3						// Priorytet LPTMR i PORTB - jak I2C0 i TSI0, producenci kolejki (event.h)
+
+/**
+ * @brief Piny S1-S4: GPIO z podciagnieciem do zasilania.
+ */
 void Klaw_Init(void);
-void Klaw_S2_4_Int(void);
+/**
+ * @brief Przerwanie PORTB na zbocze opadajace S1-S4 (PORTB_IRQHandler w main.c).
+ */
+void Klaw_Int(void);
+/**
+ * @brief Start LPTMR: takt eliminacji drgan i wyzwalanie TSI. Przed TSI_Init.
+ */
+void Klaw_Tick_Init(void);
+/**
+ * @brief Zbocze na pinie klawisza - wolane z PORTB_IRQHandler, tylko zapamietuje
+ *				klawisz do probkowania co takt. Zdarzenie EVENT_KEY wysyla LPTMR0_IRQHandler.
+ *
+ * @param Maska S1_MASK..S4_MASK z ISFR.
+ */
+void Klaw_Edge(uint32_t mask);
 
 #endif  /* KLAW_H */
@@ -7,7 +7,7 @@
  * @author Koryciak & Sokoowski
  * @date Wrzesie 2024
  * @brief File containing definitions for LCD 2x16.
- * @ver 0.4
+ * @ver 0.6
  */
 
 #include "lcd1602.h"
@@ -31,18 +31,33 @@
 #define PCF8574_EN 0x04 /* Enable bit */
 #define PCF8574_RW 0x02 /* Read/Write bit (0 = write) */
 #define PCF8574_RS 0x01 /* Register select bit */
+#define PCF8574_PER_CHAR	4		/* EN high/low for each nibble */
+#define LCD_MERGE_GAP			2		/* unchanged cells resent rather than new transaction */
+#define LCD_XFER_SIZE			(PCF8574_PER_CHAR*(LCD_COLS+1))	/* row flush: cursor + full line, see LCD1602_Flush */
 /******************************************************************************\
 * Private memory declarations
 \******************************************************************************/
 static uint8_t lcd_backlight = 1;
 static uint8_t pcf_address = PCF8574_ADDRESS;
+static char lcd_fb[LCD_ROWS][LCD_COLS];				/* wanted content (shadow buffer) */
+static char lcd_shown[LCD_ROWS][LCD_COLS];		/* content on display */
+static uint16_t lcd_dirty[LCD_ROWS];					/* cells written since last flush */
+static volatile uint8_t lcd_cursor;						/* DDRAM address, 0xFF = unknown */
+static uint8_t lcd_slow;											/* last command was clear/home (1.52 ms) */
+static I2C_Xfer lcd_xfer[LCD_ROWS];						/* queued row flush, one per row */
+static uint8_t lcd_xbuf[LCD_ROWS][LCD_XFER_SIZE];	/* its PCF8574 bytes, valid until I2C_XFER_DONE */
+static char lcd_wire[LCD_ROWS][LCD_COLS];			/* characters in the queued row flush */
+static uint16_t lcd_sent[LCD_ROWS];						/* their cells, committed to lcd_shown when done */
+static uint8_t lcd_xcursor[LCD_ROWS];					/* DDRAM address after the row flush */
 /******************************************************************************\
 * Private prototypes
 \******************************************************************************/
 void PCF8574_Write(uint8_t data);
-void LCD1602_Write4(uint8_t data, uint8_t rs);
+uint8_t *LCD1602_Pack8(uint8_t *buf, uint8_t data, uint8_t rs);
 void LCD1602_Write8(uint8_t data, uint8_t rs);
+void LCD1602_WriteData(const char *str, uint8_t len);
 void LCD1602_CheckAddress(void);
+void LCD1602_FbReset(void);
 uint8_t itoa(int value, char *ptr);
 char PL_CH_a_[] = {0x0,0x0,0xe,0x1,0xf,0x11,0xf,0x1};			// a with tail
 char PL_CH_c_[] = {0x2,0x4,0xe,0x10,0x10,0x11,0xe,0x0};		// c with accent
@@ -63,11 +78,14 @@ void LCD1602_Init(void) {
 	DELAY(200)												/* >15ms */
 	
 	LCD1602_Write8(0x33,0);					/* 4-bit interface */								
+	DELAY(50)												/* >4.1ms, busy flag not valid yet */
 	LCD1602_Write8(0x32,0);					/* HD44780U datasheet Figure 24 */
+	DELAY(50)
 	LCD1602_Write8(0x28,0);
 	LCD1602_Write8(0x08,0);
 	LCD1602_Write8(0x01,0);
 	LCD1602_Write8(0x0C,0);					/* cursor off, blink off */
+	LCD1602_FbReset();
 }
 
 void LCD1602_Blink_On(void) {
@@ -91,6 +109,102 @@ void LCD1602_SetCursor(uint8_t col, uint8_t row) {
 void LCD1602_ClearAll(void) {
 	
 	LCD1602_Write8(LCD_CLEARDISPLAY, 0);
+	LCD1602_FbReset();
+}
+
+void LCD1602_FbPrint(uint8_t col, uint8_t row, const char *str) {
+	
+	if (row >= LCD_ROWS) return;
+	while ((*str != '\0') && (col < LCD_COLS)) {		/* text past last column is dropped */
+		if (lcd_fb[row][col] != *str) {
+			lcd_fb[row][col] = *str;
+			lcd_dirty[row] |= (uint16_t)(1 << col);
+		}
+		++col;
+		++str;
+	}
+}
+
+/**
+ * @brief Row flush finished (I2C0 IRQ). Completions come in bus order,
+ *				so the last one leaves the real address counter.
+ */
+static void LCD1602_FlushDone(I2C_Xfer *x) {
+	
+	lcd_cursor = x->error ? 0xFF : lcd_xcursor[x - lcd_xfer];
+}
+
+void LCD1602_Flush(void) {
+	
+	uint8_t row, col, end, i, cursor, temp, busy;
+	uint16_t changed, sent;
+	uint8_t *ptr;
+	I2C_Xfer *x;
+	
+	if (lcd_slow) {																	/* after clear/home, rare */
+		while(LCD1602_BF_AC(&temp));
+		lcd_slow = 0;
+	}
+	busy = 0;
+	for (row = 0; row < LCD_ROWS; row++) {
+		x = &lcd_xfer[row];
+		if (x->state == I2C_XFER_PENDING) {
+			busy = 1;
+			continue;
+		}
+		if (lcd_sent[row]) {														/* previous row flush finished */
+			if (x->error) lcd_dirty[row] |= lcd_sent[row];	/* NOACK/ARBL/TIMEOUT - send again */
+			else {
+				for (i = 0; i < LCD_COLS; i++)
+					if ((lcd_sent[row] >> i) & 1) lcd_shown[row][i] = lcd_wire[row][i];
+			}
+			lcd_sent[row] = 0;
+		}
+	}
+	for (row = 0; row < LCD_ROWS; row++) {
+		x = &lcd_xfer[row];
+		if (x->state == I2C_XFER_PENDING) continue;		/* buffer still on the bus, cells stay dirty */
+		changed = 0;
+		for (col = 0; col < LCD_COLS; col++) {
+			if ((lcd_dirty[row] & (1 << col)) && (lcd_fb[row][col] != lcd_shown[row][col]))
+				changed |= (uint16_t)(1 << col);
+		}
+		if (!changed) {
+			lcd_dirty[row] = 0;
+			continue;
+		}
+		/* Runs are at least LCD_MERGE_GAP+1 cells apart, so r runs with cursor
+		   commands take at most 4*(r + 16 - 3*(r-1)) <= LCD_XFER_SIZE bytes */
+		ptr = lcd_xbuf[row];
+		cursor = busy ? 0xFF : lcd_cursor;						/* address unknown until queued rows finish */
+		sent = 0;
+		col = 0;
+		while (changed >> col) {
+			while (!((changed >> col) & 1)) col++;			/* start of run */
+			end = col;
+			for (i = col; (i < LCD_COLS) && (i <= end + LCD_MERGE_GAP + 1); i++)
+				if ((changed >> i) & 1) end = i;					/* short gaps join the run */
+			if ((col + LCD_FULLLINE*row) != cursor)
+				ptr = LCD1602_Pack8(ptr, LCD_SETDDRAMADDR | (col + LCD_FULLLINE*row), 0);
+			for (i = col; i <= end; i++) {
+				ptr = LCD1602_Pack8(ptr, (uint8_t)lcd_fb[row][i], 1);
+				lcd_wire[row][i] = lcd_fb[row][i];
+				sent |= (uint16_t)(1 << i);
+			}
+			cursor = end + 1 + LCD_FULLLINE*row;
+			col = end + 1;
+		}
+		x->address = pcf_address;											/* whole row in one queued transaction */
+		x->flags = 0;
+		x->size = (uint8_t)(ptr - lcd_xbuf[row]);
+		x->data = lcd_xbuf[row];
+		x->callback = LCD1602_FlushDone;
+		lcd_xcursor[row] = cursor;
+		if (I2C_Submit(x)) continue;									/* queue full - retry on next flush */
+		lcd_sent[row] = sent;													/* shown only after the transfer succeeds */
+		lcd_dirty[row] = 0;
+		busy = 1;
+	}
 }
 
 void LCD1602_Print(char *str) {
@@ -99,9 +213,9 @@ void LCD1602_Print(char *str) {
 	
   while (str[str_len] != '\0') /* until end of string */
 	{             
-    LCD1602_Write8(str[str_len], 1);
     ++str_len;
   }
+	LCD1602_WriteData(str, str_len);
 }
 
 void LCD1602_PrintNum(int number) {
@@ -129,28 +243,91 @@ void PCF8574_Write(uint8_t data) {
 	I2C_Write(pcf_address, data | (lcd_backlight?PCF8574_BL:0x00));
 }
 /**
- * @brief Write 4 bits to LCD.
+ * @brief Build PCF8574 bytes for one LCD byte: both nibbles with EN high, then low.
  *
- * @param A lower nibble of the byte.
+ * @param Buffer for PCF8574_PER_CHAR bytes.
+ * @param Data to send.
  * @param Register select.
+ * @return Buffer position after written bytes.
  */
-void LCD1602_Write4(uint8_t data, uint8_t rs) {
+uint8_t *LCD1602_Pack8(uint8_t *buf, uint8_t data, uint8_t rs) {
 	
-	PCF8574_Write(((data << 4)&0xF0) | (rs?PCF8574_RS:0x00) | PCF8574_EN);
-	PCF8574_Write(((data << 4)&0xF0) | (rs?PCF8574_RS:0x00));
-	//DELAY(27)
+	uint8_t ctrl = (rs?PCF8574_RS:0x00) | (lcd_backlight?PCF8574_BL:0x00);
+	
+	*buf++ = (data & 0xF0) | ctrl | PCF8574_EN;
+	*buf++ = (data & 0xF0) | ctrl;
+	*buf++ = ((data << 4)&0xF0) | ctrl | PCF8574_EN;
+	*buf++ = ((data << 4)&0xF0) | ctrl;
+	return buf;
 }
 /**
- * @brief Write byte to LCD.
+ * @brief Write byte to LCD. One I2C transaction, busy flag is read
+ *				only after clear/home - other instructions finish (37us) before
+ *				next byte gets through I2C.
  *
  * @param Data to send.
  * @param Register select
  */
 void LCD1602_Write8(uint8_t data, uint8_t rs) {
 	uint8_t temp;
-	while(LCD1602_BF_AC(&temp));
-	LCD1602_Write4(((data >> 4)&0x0F), rs);
-	LCD1602_Write4(( data      &0x0F), rs);
+	uint8_t buf[PCF8574_PER_CHAR];
+	
+	if (lcd_slow) {
+		while(LCD1602_BF_AC(&temp));
+		lcd_slow = 0;
+	}
+	LCD1602_Pack8(buf, data, rs);
+	I2C_WriteBlock(pcf_address, PCF8574_PER_CHAR, buf);
+	if (!rs && (data <= 0x03)) lcd_slow = 1;			/* clear display, return home */
+	
+	if (rs) lcd_cursor++;														/* track address counter for flush */
+	else if (data & LCD_SETDDRAMADDR) lcd_cursor = data & 0x7F;
+	else if (data == LCD_CLEARDISPLAY) lcd_cursor = 0;
+	else if (data & 0x40) lcd_cursor = 0xFF;				/* CGRAM address */
+}
+/**
+ * @brief Write characters to LCD as one I2C transaction.
+ *
+ * @param Characters.
+ * @param Count of characters.
+ */
+void LCD1602_WriteData(const char *str, uint8_t len) {
+	
+	uint8_t temp, n;
+	uint8_t buf[PCF8574_PER_CHAR*LCD_COLS];
+	uint8_t *ptr;
+	
+	if (lcd_slow) {
+		while(LCD1602_BF_AC(&temp));
+		lcd_slow = 0;
+	}
+	while (len) {																		/* up to a full line per transaction */
+		n = (len > LCD_COLS) ? LCD_COLS : len;
+		ptr = buf;
+		for (temp = 0; temp < n; temp++) ptr = LCD1602_Pack8(ptr, (uint8_t)str[temp], 1);
+		I2C_WriteBlock(pcf_address, (uint8_t)(ptr - buf), buf);
+		lcd_cursor += n;
+		str += n;
+		len -= n;
+	}
+}
+/**
+ * @brief Fill shadow buffer and display copy with spaces (display cleared).
+ *
+ */
+void LCD1602_FbReset(void) {
+	
+	uint8_t row, col;
+	
+	for (row = 0; row < LCD_ROWS; row++) {
+		for (col = 0; col < LCD_COLS; col++) {
+			lcd_fb[row][col] = ' ';
+			lcd_shown[row][col] = ' ';
+		}
+		lcd_dirty[row] = 0;
+		lcd_sent[row] = 0;														/* queued row flush went before the clear */
+	}
+	lcd_cursor = 0;
 }
 /**
  * @brief Check which version of PCF is connected.
@@ -16,6 +16,8 @@
 #include "frdm_bsp.h"
 #include "i2c.h"
 
+#define LCD_COLS		16
+#define LCD_ROWS		2
 
 /**
  * @brief LCD1602 initialization.
@@ -38,6 +40,23 @@ void LCD1602_ClearAll(void);
  * @param Row.
  */
 void LCD1602_SetCursor(uint8_t col, uint8_t row);
+/**
+ * @brief Print to shadow buffer only, no I2C traffic. Send with LCD1602_Flush.
+ *				Do not mix with LCD1602_Print on the same cells.
+ *
+ * @param Column.
+ * @param Row.
+ * @param String to display (cut at last column).
+ */
+void LCD1602_FbPrint(uint8_t col, uint8_t row, const char *str);
+/**
+ * @brief Send cells changed since last flush. Cursor is set only where
+ *				a run of changed cells does not continue the previous one.
+ *				Each row goes out as one queued I2C transfer and the function
+ *				returns without waiting. A row whose previous transfer is still
+ *				on the bus (or a full I2C queue) is left for the next flush.
+ */
+void LCD1602_Flush(void);
 /**
  * @brief Backlight turn on/off.
  *
@@ -6,301 +6,351 @@
 					rev 1.4
 ----------------------------------------------------------------------------*/
 
-#include "MKL05Z4.h"
+#include "main.h"
 #include "DAC.h"
 #include "tsi.h"
 #include "klaw.h"
 #include "frdm_bsp.h"
 #include "lcd1602.h"
 #include "i2c.h"
+#include "accel.h"
+#include "hal.h"
+#include "prof.h"
+#include "evlog.h"
+#include "event.h"
+
+#include "synth.h"
+#include "audio.h"
+#include "env.h"
+#include "glide.h"
+#include "scale.h"
+#include "dds.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <math.h>
-#define	ZYXDR_Mask	1<<3 // Maska dla flagi gotowości danych akcelerometru
-#define DIV_CORE	32768	
-#define ACCEL_SENSITIVITY 0 // Czułość akcelerometru
-//#define ACCEL_UPDATE_PERIOD 50
-
-// Częstotliwości dla 13 dźwięków (C4 do C5)
-const float frequencies[] = {
-    261.63, 277.18, 293.66, 311.13, 329.63, 349.23,
-    369.99, 392.00, 415.30, 440.00, 466.16, 493.88, 523.25
-};
-
-// Nazwy nut
-const char *noteNames[] = {
-    "C", "C#", "D", "D#", "E", "F",
-    "F#", "G", "G#", "A", "A#", "B", "C"
-};
-
-volatile uint8_t S2_press = 0;       // Flaga dla przycisku S2
-volatile uint8_t S3_press = 0;       // Flaga dla przycisku S3
-volatile uint8_t S4_press = 0;       // Flaga dla przycisku S4
-
-volatile float currentNote = 0; // Indeks aktualnej nuty
+
+// Nazwy nut (częstotliwości w NOTE_TABLE, main.h)
+#define NOTE_NAME(f, name, arg)	name,
+const char *noteNames[] = { NOTE_TABLE(NOTE_NAME, 0) };
+
+volatile uint16_t notePitch = 0; // Nuta względem C oktawy (półtony Q8, Scale_Pitch)
 volatile int8_t octave = 0;     // Aktualna oktawa
 volatile uint8_t waveForm = 0;   // Aktualny kształt fali (0-sinus, 1-trojkat, 2-pila)
-volatile uint8_t volume = 20;   // Głośność (0-100)
-
-volatile uint16_t dac;	// Wartość do wysłania do DAC
-volatile int32_t Sinus[20];
-const int32_t Trojkat[] = {0, 409, 818, 1227, 1636, 2045, 1636, 1227, 818, 409, 0, -409, -818, -1227, -1636, -2045, -1636, -1227, -818, -409};
-const int32_t Pila[] = {0, 205, 409, 614, 819, 1024, 1228, 1433, 1638, 1842, 2047, -2047, -1820, -1592, -1365, -1137, -910, -682, -455, -227};
-volatile float n;	// Zmienna do generowania fazy w DDS
-volatile uint8_t trig = 0;	// Flaga do generowania sygnału
+// Parametry ustawiane sliderem (0-100), wybór parametru przyciskiem S1
+enum { PARAM_VOL, PARAM_ATK, PARAM_DEC, PARAM_SUS, PARAM_REL, PARAM_GLD, PARAM_GTM,
+       PARAM_SCL, PARAM_KEY, PARAM_RNG, PARAM_COUNT };
+const char *paramNames[PARAM_COUNT] = { "Vol", "Atk", "Dec", "Sus", "Rel", "Gld", "Gtm", "Skl", "Ton", "Zak" };
+uint8_t paramValue[PARAM_COUNT] = { 20, 5, 30, 70, 30, 0, 30, 0, 0, 0 };
+#define PARAM_STEP(v, n)	((uint8_t)((uint16_t)(v) * (n) / 101))	// Slider 0-100 na n pozycji
+uint8_t paramSel = PARAM_VOL;   // Parametr aktualnie zmieniany sliderem, PAGE_DIAG - strona diagnostyczna
+#define PAGE_DIAG PARAM_COUNT   // Za ostatnim parametrem: pomiary czasu z prof.c
+static uint32_t diagTick;       // sysTicks przy ostatnim odświeżeniu strony
+const char *glideNames[] = { "wyl", "pol", "cia" };	// Portamento: wyłączone, półtony, ciągłe
 
 // Zmienne do obsługi akcelerometru i wyświetlacza
-volatile uint8_t update_accel = 0;   // Flaga do aktualizacji danych z akcelerometru
-volatile int16_t accelX = 0;         // Wartość odczytana z osi X akcelerometru
+volatile int16_t accelX = 0;         // Wartość osi X akcelerometru (średnia z paczki FIFO)
 volatile uint8_t update_display = 0; // Flaga do aktualizacji wyświetlacza
-static uint8_t status;               // Status akcelerometru
+static char display[17];             // Bufor na wyswietlanie danych
+static uint8_t sliderLast;           // Ostatnia pozycja slidera w rejestrze zdarzeń
+
+volatile uint32_t sysTicks = 0;      // Takty SysTick od startu (TICK_RATE)
 
+// Takt systemowy - SysTick wolny, zegar próbek to TPM0
 void SysTick_Handler(void)
 {
-    /*/ Flaga do aktualizacji danych z akcelerometru
-    /static uint32_t accel_count = 0;
-    accel_count++;
-    if (accel_count >= ACCEL_UPDATE_PERIOD) {
-        update_accel = 1;
-        accel_count = 0;
-    }*/
-
-    trig ^= 0x1;	// Przełączanie flagi trig (co drugie przerwanie)
-    if (trig)
-    {
-				// Obliczenie częstotliwości
-        float currentFrequency = frequencies[(int)round(currentNote)] * pow(2, octave);
-        // Obliczenie przyrostu fazy
-        float phaseIncrement = currentFrequency / (SystemCoreClock / DIV_CORE / 2.0f) * 20.0f;
-
-        uint16_t n_range = 20;       // Zakres wartości fazy
-        uint16_t n_int = (uint16_t)n; // Bieżąca wartość fazy
-
-				// Generowanie sygnału w zależności od wybranego kształtu fali
-			  // dodane 0x0800 czyli 2048 aby uzyskac dodatnie wyniki dla dac
-        switch (waveForm)
-        {
-        case 0:
-            dac = (Sinus[n_int % 20] * volume / 100) + 0x0800; 
-            break;
-        case 1:
-            dac = (Trojkat[n_int % 20] * volume / 100) + 0x0800;
-            break;
-        case 2:
-            dac = (Pila[n_int % 20] * volume / 100) + 0x0800;
-            break;
-        }
-
-        DAC_Load_Trig(dac);
-        n += phaseIncrement;
-        if (n >= n_range)
-        {
-            n = fmod(n, n_range);	// Normalizacja fazy
-        }
-    }
+    sysTicks++;
+    Prof_Tick();
 }
-// Przerwanie PORTA - obsługa akcelerometru na PTA10
+
+// Przerwanie PORTA - próg FIFO akcelerometru na PTA10
 void PORTA_IRQHandler(void)
 {
-    if (PORTA->ISFR & (1 << 10)) {
-        update_accel = 1;
-				PORTA->ISFR |= (1 << 10);
+    uint16_t t0 = Prof_Now();
+    if (PORTA->ISFR & (1 << ACCEL_INT_PIN)) {
+        Accel_Fetch();	// Odczyt paczki w tle, wynik jako EVENT_ACCEL
+				PORTA->ISFR |= (1 << ACCEL_INT_PIN);
 			}
-		
+    Prof_End(PROF_PORTA, t0);
 }
-// Przerwanie PORTB - obsługa przycisków
+// Przerwanie PORTB - zbocze na przycisku, drgania styków filtruje takt LPTMR (klaw.c)
 void PORTB_IRQHandler(void)
 {
+		uint16_t t0 = Prof_Now();
 		uint32_t buf;
-    buf = PORTB->ISFR & (S2_MASK | S3_MASK | S4_MASK); // Sprawdzenie, który przycisk wywołał przerwanie
+    buf = PORTB->ISFR & (S1_MASK | S2_MASK | S3_MASK | S4_MASK); // Sprawdzenie, który przycisk wywołał przerwanie
+    Klaw_Edge(buf);
+	PORTB->ISFR |= S1_MASK | S2_MASK | S3_MASK | S4_MASK;	// Czyszczenie flagi przerwan
+	NVIC_ClearPendingIRQ(PORTB_IRQn);
+	Prof_End(PROF_PORTB, t0);
+}
 
-		// Minimalizacja drgan ze stykow i ustawianie flagi dla przyciskow
-    switch (buf)
+// Najwyższa oktawa, przy której tonika i cały zakres skali mieszczą się
+// w tablicy strojenia (DDS_PITCH_MAX, poniżej fs/2) - bez martwej strefy wychylenia
+int8_t Octave_Top(void)
+{
+    return (int8_t)(OCTAVE_MAX - (Scale_Range() - 1) - (Scale_Root() ? 1 : 0));
+}
+
+// Przeniesienie wartości parametru (0-100) do silnika syntezy
+void Apply_Param(uint8_t param)
+{
+    uint8_t v = paramValue[param];
+    uint16_t ms = 1 + (uint16_t)v * v / 5;	// Czasy obwiedni: 1 ms - 2 s, gęściej dla krótkich
+    switch (param)
     {
-    case S2_MASK:
-        DELAY(100);
-        if (!(PTB->PDIR & S2_MASK)) 
-        {
-            DELAY(100);
-            if (!(PTB->PDIR & S2_MASK))
-            {
-                if (!S2_press)
-                {
-                    S2_press = 1;
-                }
-            }
-        }
-        break;
-    case S3_MASK:
-        DELAY(100);
-        if (!(PTB->PDIR & S3_MASK)) 
-        {
-            DELAY(100);
-            if (!(PTB->PDIR & S3_MASK))
-            {
-                if (!S3_press)
-                {
-                    S3_press = 1;
-                }
-            }
-        }
-        break;
-		case S4_MASK:
-        DELAY(100);
-        if (!(PTB->PDIR & S4_MASK)) 
-        {
-            DELAY(100);
-            if (!(PTB->PDIR & S4_MASK))
-            {
-                if (!S4_press)
-                {
-                    S4_press = 1;
-                }
-            }
-        }
-        break;
-    default:
-        break;
+    case PARAM_VOL: Synth_SetVolume(v); break;
+    case PARAM_ATK: Env_SetAttack(ms); break;
+    case PARAM_DEC: Env_SetDecay(ms); break;
+    case PARAM_SUS: Env_SetSustain(v); break;
+    case PARAM_REL: Env_SetRelease(ms); break;
+    case PARAM_GLD: Synth_SetGlide(v / 34); break;	// Slider w trzech zakresach: GLIDE_OFF, GLIDE_QUANT, GLIDE_CONT
+    case PARAM_GTM: Synth_SetGlideTime(ms); break;
+    case PARAM_SCL: Scale_Select(PARAM_STEP(v, SCALE_COUNT)); break;
+    case PARAM_KEY: Scale_SetRoot(PARAM_STEP(v, 12)); break;
+    case PARAM_RNG: Scale_SetRange(1 + PARAM_STEP(v, SCALE_RANGE_MAX)); break;
     }
-	PORTB->ISFR |= S2_MASK | S3_MASK | S4_MASK;	// Czyszczenie flagi przerwan
-	NVIC_ClearPendingIRQ(PORTB_IRQn);
+    if (param >= PARAM_SCL) {	// Nowa skala od razu, bez czekania na akcelerometr
+        if (octave > Octave_Top()) octave = Octave_Top();
+        notePitch = Scale_Pitch(accelX);
+        update_display = 1;
+    }
+}
+
+// Tekst wybranego parametru do wiersza 1 wyświetlacza (8 znaków)
+void Param_Format(char *buf)
+{
+    uint8_t v = paramValue[paramSel];
+    if (paramSel == PARAM_GLD)
+        sprintf(buf, "%s: %s", paramNames[paramSel], glideNames[v / 34]);
+    else if (paramSel == PARAM_SCL)
+        sprintf(buf, "%s: %s", paramNames[paramSel], Scale_Name(PARAM_STEP(v, SCALE_COUNT)));
+    else if (paramSel == PARAM_KEY)
+        sprintf(buf, "%s: %-3s", paramNames[paramSel], noteNames[PARAM_STEP(v, 12)]);
+    else if (paramSel == PARAM_RNG)
+        sprintf(buf, "%s: %3d", paramNames[paramSel], 1 + PARAM_STEP(v, SCALE_RANGE_MAX));
+    else
+        sprintf(buf, "%s: %3d", paramNames[paramSel], paramValue[paramSel]);
+}
+
+// Strona diagnostyczna: renderowanie - średnio/maks. % czasu bloku i przekroczenia
+// (razem z zegarem próbek), najdłuższe przerwanie zegara próbek i przycisków [us]
+void Diag_Show(void)
+{
+    uint16_t budget = profStats[PROF_RENDER].budget;
+    uint32_t avg = Prof_Avg(PROF_RENDER) * 100u / budget;
+    uint32_t max = profStats[PROF_RENDER].max * 100u / budget;
+    uint32_t over = profStats[PROF_RENDER].overruns + profStats[PROF_SAMPLE].overruns;
+    uint32_t sample = Prof_Us(profStats[PROF_SAMPLE].max);
+
+    // Ograniczenie do szerokości pól (16 znaków)
+    if (avg > 999) avg = 999;
+    if (max > 999) max = 999;
+    if (over > 9999) over = 9999;
+    if (sample > 999) sample = 999;
+    sprintf(display, "R%3u%%/%3u%% x%-4u", (unsigned)avg, (unsigned)max, (unsigned)over);
+    LCD1602_FbPrint(0, 0, display);
+    sprintf(display, "S%3uus idle%3u%%", (unsigned)sample, (unsigned)profIdle);
+    LCD1602_FbPrint(0, 1, display);
+}
+
+// Nazwa nuty do wiersza 0, stała szerokość 4 znaków - notePitch z toniką
+// i zakresem może wykraczać poza oktawę
+void Note_Format(char *buf)
+{
+    char note[8];
+    uint8_t semi = (uint8_t)((notePitch + 128) >> 8);
+    uint8_t oct = (uint8_t)((semi * 683u) >> 13);	// semi / 12 bez dzielenia
+    sprintf(note, "%s%d", noteNames[semi - oct * 12], octave + 4 + oct);
+    sprintf(buf, "%-4s", note);
+}
+
+// Wysokość dźwięku z nuty i oktawy (półtony Q8 względem C najniższej oktawy)
+uint16_t Current_Pitch(void)
+{
+    uint32_t pitch = (uint32_t)(octave - OCTAVE_MIN) * (12 << 8) + notePitch;
+    return (uint16_t)(pitch > DDS_PITCH_MAX ? DDS_PITCH_MAX : pitch);	// Octave_Top - tylko zabezpieczenie
 }
 
 void Init_Accel(void) {
-    I2C_Init();
-	// Przerwania dla freefall/ motion oraz dla osi X
-    I2C_WriteReg(0x1D, 0x2A, 0x00);
-    I2C_WriteReg(0x1D, 0x0E, ACCEL_SENSITIVITY);
-		I2C_WriteReg(0x1D, 0x15, 0xC8); 
-		I2C_WriteReg(0x1D, 0x2D, 0x04);
-		I2C_WriteReg(0x1D, 0x2E, 0x00);
-    I2C_WriteReg(0x1D, 0x2A, 0x23); 
-
-    SIM->SCGC5 |= SIM_SCGC5_PORTA_MASK;
-    PORTA->PCR[10] |= PORT_PCR_MUX(1) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK | PORT_PCR_IRQC(0xb);
-	
-		PORTB->PCR[0] |= PORT_PCR_MUX(1) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK | PORT_PCR_IRQC(0xA); // GPIO, pull-up, interrupt na zbocze opadające
-    PORTB->PCR[2] |= PORT_PCR_MUX(1) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK | PORT_PCR_IRQC(0xA); 
-    PORTB->PCR[6] |= PORT_PCR_MUX(1) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK | PORT_PCR_IRQC(0xA); 
-
-    NVIC_SetPriority(PORTA_IRQn, 3);
-    NVIC_ClearPendingIRQ(PORTA_IRQn);
-    NVIC_EnableIRQ(PORTA_IRQn);
-		
-		NVIC_SetPriority(PORTB_IRQn, 3);
-    NVIC_ClearPendingIRQ(PORTB_IRQn);
-    NVIC_EnableIRQ(PORTB_IRQn);
+    Accel_Init();	// FIFO z progiem, przerwanie na PTA10
+
+    Klaw_Init();	// S1-S4 na PTB7/0/2/6 (klaw.h), pull-up
+    Klaw_Int();		// Zbocze opadające - PORTB_IRQHandler
+		Klaw_Tick_Init();	// Takt eliminacji drgań dla PORTB_IRQHandler
 }
 
-int main(void)
+// Inicjalizacja sprzętu i silnika - raz, z main() albo z symulatora (sim/)
+void App_Init(void)
 {
-    char display[17]; // Bufor na wyswietlanie danych
-		
-    //Klaw_Init();
-    //Klaw_S2_4_Int();
+    Prof_Init();	// Licznik TPM1 do pomiarów czasu przerwań
+    SysTick_Config(SystemCoreClock / TICK_RATE);	// Takt systemowy, najniższy priorytet
+    EvLog_Init();	// Rejestr zdarzeń sterowania
     LCD1602_Init();
     LCD1602_Backlight(TRUE);
     DAC_Init();
     Init_Accel();
     TSI_Init();
 
-		// Generowanie tablicy sinusoidy
-    for (int i = 0; i < 20; i++)
-        Sinus[i] = (sin((double)i * 0.314159) * 2047.0);
-    n = 0;
+    Synth_Init();
+    Synth_SetWave(waveForm);
+    for (uint8_t i = 0; i < PARAM_COUNT; i++)
+        Apply_Param(i);
+    Synth_SetPitch(Current_Pitch());
 
-    LCD1602_SetCursor(0, 0);
-    sprintf(display, "%s%d", noteNames[(int)round(currentNote)], octave + 4);
-    LCD1602_Print(display);
+    Note_Format(display);
+    LCD1602_FbPrint(0, 0, display);
 
-    LCD1602_SetCursor(0, 1);
-    sprintf(display, "Vol: %3d", volume);
-    LCD1602_Print(display);
+    Param_Format(display);
+    LCD1602_FbPrint(0, 1, display);
 
-    LCD1602_SetCursor(8, 1);
     switch (waveForm)
     {
     case 0:
-        LCD1602_Print("Sinus   ");
+        LCD1602_FbPrint(8, 1, "Sinus   ");
         break;
     case 1:
-        LCD1602_Print("Trojkat ");
+        LCD1602_FbPrint(8, 1, "Trojkat ");
         break;
     case 2:
-        LCD1602_Print("Pila    ");
+        LCD1602_FbPrint(8, 1, "Pila    ");
         break;
     }
 
-    SysTick_Config(SystemCoreClock / DIV_CORE);	// Konfiguracja przerwania SysTick
-		uint8_t temp;
-    while (1)
+    LCD1602_Flush();
+
+    Audio_Init();	// Wypełnienie bufora i start zegara próbkowania
+}
+
+// Obsługa przycisków: S1 - parametr slidera / strona diagnostyczna,
+// S2/S3 - oktawa w górę/w dół, S4 - kształt fali
+void Key_Press(uint8_t key)
+{
+    switch (key)
     {
-			I2C_ReadReg(0x1d,0x16,&temp);
-			I2C_ReadReg(0x1d, 0x0, &status);
-		status&=ZYXDR_Mask;
-		if(update_accel)	// Czy dane gotowe do odczytu?
-		{
-		// Obsługa akcelerometru
-        if (status) {
-            update_accel = 0;
-            uint8_t accelData[2]; // 2 bajty - os X
-            I2C_ReadRegBlock(0x1D, 0x01, 2, accelData); // odczyt z OUT_X_MSB i OUT_X_LSB (0x01 i 0x02)
-            accelX = (int16_t)((accelData[0] << 8) | accelData[1]) >> 2;
-            currentNote = 6.5f + (float)accelX / 4096.0f * 6.0f;
-            if (currentNote < 0) currentNote = 0;
-            if (currentNote > 12) currentNote = 12;
-						update_display = 1; // Zasygnalizowanie konieczności aktualizacji wyświetlacza
+    case 1:
+        paramSel = (paramSel + 1) % (PARAM_COUNT + 1);
+        if (paramSel == PAGE_DIAG) {
+            Prof_Reset();	// Maksima od wejścia na stronę
+            diagTick = sysTicks;
+            Diag_Show();
+        } else {
+            if (paramSel == PARAM_VOL)	// Powrót ze strony diagnostycznej - nuta i fala od nowa
+            {
+                LCD1602_FbPrint(0, 0, "                ");
+                update_display = 1;
+            }
+            Param_Format(display);
+            LCD1602_FbPrint(0, 1, display);
+        }
+        break;
+    case 2:
+        octave++;
+        if (octave > Octave_Top()) octave = Octave_Top();
+        update_display = 1;
+        break;
+    case 3:
+        octave--;
+        if (octave < OCTAVE_MIN) octave = OCTAVE_MIN;
+        update_display = 1;
+        break;
+    case 4:
+        waveForm = (waveForm + 1) % 3;
+        update_display = 1;
+        break;
+    }
+}
+
+// Obsługa slidera - nowa pozycja (EVENT_TSI) do wybranego parametru
+void Slider_Update(uint8_t sliderValue)
+{
+    if (sliderValue != sliderLast) {
+        sliderLast = sliderValue;
+        EvLog_Put(EVLOG_SLIDER, sliderValue);
+    }
+    if (sliderValue != 0 && paramSel != PAGE_DIAG) {
+        paramValue[paramSel] = sliderValue;
+        Apply_Param(paramSel);
+        Param_Format(display);
+        LCD1602_FbPrint(0, 1, display);
+    }
+}
+
+// Jeden obieg pętli głównej
+void App_Poll(void)
+{
+    uint16_t t0 = Prof_Now();
+    I2C_Poll();		// Kolejka I2C czekająca na wolną magistralę (zapas dla przerwania STOP)
+    Accel_Poll();	// Odczyt FIFO nie zlecony po zboczu INT2 - ponowienie
+    // Zdarzenia z przerwań - cała kolejka w jednym obiegu
+    Event ev;
+    while (Event_Get(&ev)) {
+        switch (ev.type) {
+        case EVENT_ACCEL:	// Średnia paczki ACCEL_WMRK próbek z FIFO
+            accelX = ev.value;
+            notePitch = Scale_Pitch(accelX);	// Skala, tonika i zakres (scale.c)
+            update_display = 1; // Zasygnalizowanie konieczności aktualizacji wyświetlacza
+            break;
+        case EVENT_KEY:
+            Key_Press((uint8_t)ev.value);
+            break;
+        case EVENT_TSI:
+            Slider_Update((uint8_t)ev.value);
+            break;
         }
-				// Obsługa przycisków
-				if(S2_press){
-					S2_press = 0;
-					octave++;
-					if (octave > 3) octave = 3;
-					update_display = 1;
-				}
-
-				if(S3_press){
-					S3_press = 0;
-					octave--;
-					if (octave < -3) octave = -3;
-					update_display = 1;
-				}
-
-				if(S4_press){
-					S4_press = 0;
-					waveForm = (waveForm + 1) % 3;
-					update_display = 1;
-				}
-        // Obsługa wyświetlacza
-        if (update_display) {
-            update_display = 0;
-            LCD1602_SetCursor(0, 0);
-            sprintf(display, "%s%d ", noteNames[(int)round(currentNote)], octave + 4);
-            LCD1602_Print(display);
-
-            LCD1602_SetCursor(8, 1);
+    }
+    // Obsługa wyświetlacza
+    if (update_display) {
+        update_display = 0;
+        Synth_SetWave(waveForm);
+        Synth_SetPitch(Current_Pitch());	// Nowa nuta lub oktawa
+        if (paramSel != PAGE_DIAG) {
+            Note_Format(display);
+            LCD1602_FbPrint(0, 0, display);
+
             switch (waveForm) {
                 case 0:
-                    LCD1602_Print("Sinus   ");
+                    LCD1602_FbPrint(8, 1, "Sinus   ");
                     break;
                 case 1:
-                    LCD1602_Print("Trojkat ");
+                    LCD1602_FbPrint(8, 1, "Trojkat ");
                     break;
                 case 2:
-                    LCD1602_Print("Pila    ");
+                    LCD1602_FbPrint(8, 1, "Pila    ");
                     break;
             }
         }
+    }
 
-        // Obsługa slidera
-        uint8_t sliderValue = TSI_ReadSlider();
-        if (sliderValue != 0) {
-            volume = sliderValue;
-            LCD1602_SetCursor(0, 1);
-            sprintf(display, "Vol: %3d", volume);
-            LCD1602_Print(display);
-        }
+    if (paramSel == PAGE_DIAG && sysTicks - diagTick >= TICK_RATE / 4) {	// 4 razy na sekundę
+        diagTick = sysTicks;
+        Diag_Show();
+    }
+
+    // Wysłanie do wyświetlacza tylko zmienionych znaków
+    uint16_t t1 = Prof_Now();
+    LCD1602_Flush();
+    Prof_End(PROF_LCD, t1);
+    Prof_End(PROF_LOOP, t0);
+}
+
+#ifndef SIM_BUILD
+// Uśpienie rdzenia do przerwania, gdy nie ma zdarzeń do obsłużenia. Sprawdzenie
+// kolejki i WFI przy wyłączonych przerwaniach - zdarzenie wstawione w międzyczasie
+// zostawia przerwanie oczekujące, które budzi rdzeń zamiast zostać przespane
+static void App_Sleep(void)
+{
+    __disable_irq();
+    if (!Event_Pending())
+        Prof_Sleep();
+    __enable_irq();
+}
+
+int main(void)
+{
+    App_Init();
+    while (1) {
+        App_Poll();
+        App_Sleep();
     }
-	}
 }
+#endif
@@ -1 +1,39 @@
+#ifndef MAIN_H
+#define MAIN_H
+
 #include "MKL05Z4.h"
+
+// Częstotliwość próbkowania [Hz] - zegar TPM0. Tablice strojenia, obwiednia,
+// portamento i budżety czasu (prof.c) liczone są od niej w czasie kompilacji.
+// Inna wartość: opcja kompilatora -DSAMPLE_RATE=... (make SAMPLE_RATE=...)
+#define SAMPLE_RATE_8K		8000
+#define SAMPLE_RATE_16K		16384								// Dzielnik całkowity zegara rdzenia (41.94 MHz)
+#define SAMPLE_RATE_22K		22050
+#define SAMPLE_RATE_32K		32000
+#ifndef SAMPLE_RATE
+#define SAMPLE_RATE	SAMPLE_RATE_16K
+#endif
+#define TICK_RATE	1000									// Takt systemowy SysTick [Hz] (sysTicks)
+#define NOTE_COUNT	13										// Liczba dźwięków (C4 do C5)
+#define OCTAVE_MIN	(-3)									// Zakres przełączania oktawy względem C4
+// Najwyższa oktawa: C na końcu wiersza tablicy strojenia (523.25 Hz * 2^OCTAVE_MAX)
+// poniżej fs/2 - wyżej słowo strojenia >= 2^31 i nawet sinus zawija się w alias
+#if SAMPLE_RATE > 2 * 4187
+#define OCTAVE_MAX	3											// Do C8 (4186 Hz)
+#elif SAMPLE_RATE > 2 * 2094
+#define OCTAVE_MAX	2											// Do C7 (2093 Hz), np. 8 kHz
+#else
+#define OCTAVE_MAX	1
+#endif
+#define OCTAVE_COUNT	(OCTAVE_MAX - OCTAVE_MIN + 1)
+
+// Częstotliwości [Hz] i nazwy 13 dźwięków (C4 do C5) - jedno źródło dla tablic
+// strojenia (dds.c) i nazw na wyświetlaczu; X(częstotliwość, nazwa, arg)
+#define NOTE_TABLE(X, arg) \
+	X(261.63, "C",  arg) X(277.18, "C#", arg) X(293.66, "D",  arg) \
+	X(311.13, "D#", arg) X(329.63, "E",  arg) X(349.23, "F",  arg) \
+	X(369.99, "F#", arg) X(392.00, "G",  arg) X(415.30, "G#", arg) \
+	X(440.00, "A",  arg) X(466.16, "A#", arg) X(493.88, "B",  arg) \
+	X(523.25, "C",  arg)
+
+#endif /* MAIN_H */
@@ -0,0 +1,84 @@
+#include "prof.h"
+#include "audio.h"
+
+volatile ProfStat profStats[PROF_COUNT];
+volatile uint8_t profIdle;
+static uint32_t idleTicks;								// Takty TPM1 w WFI od początku okna
+static uint16_t idleWindow;								// Takty SysTick w oknie
+
+void Prof_Init(void)
+{
+	uint32_t tickHz = SystemCoreClock >> PROF_PS;
+
+	SIM->SCGC6 |= SIM_SCGC6_TPM1_MASK;
+	SIM->SOPT2 |= SIM_SOPT2_TPMSRC(1);			// Zegar TPM = MCGFLLCLK (= SystemCoreClock)
+	TPM1->SC = 0;
+	TPM1->CNT = 0;
+	TPM1->MOD = 0xFFFF;											// Wolnobieżny, różnice liczone modulo 2^16
+	TPM1->SC = TPM_SC_CMOD(1) | TPM_SC_PS(PROF_PS);
+
+	Prof_Reset();
+	profStats[PROF_SAMPLE].budget = tickHz / SAMPLE_RATE;
+	profStats[PROF_RENDER].budget = tickHz / (SAMPLE_RATE / AUDIO_BLOCK);
+}
+
+void Prof_Reset(void)
+{
+	for (uint8_t i = 0; i < PROF_COUNT; i++) {
+		__disable_irq();
+		profStats[i].min = 0xFFFF;
+		profStats[i].max = 0;
+		profStats[i].sum = 0;
+		profStats[i].count = 0;
+		profStats[i].overruns = 0;
+		__enable_irq();
+	}
+}
+
+uint16_t Prof_Avg(uint8_t id)
+{
+	uint32_t sum, count;
+
+	__disable_irq();
+	sum = profStats[id].sum;
+	count = profStats[id].count;
+	__enable_irq();
+	return count ? (uint16_t)(sum / count) : 0;
+}
+
+void Prof_Sleep(void)
+{
+	uint16_t t0 = Prof_Now();
+	__WFI();
+	idleTicks += (uint16_t)(Prof_Now() - t0);	// Przed obsługą przerwania, które obudziło rdzeń
+}
+
+void Prof_Tick(void)
+{
+	if (++idleWindow < TICK_RATE) return;
+	idleWindow = 0;
+	profIdle = (uint8_t)(idleTicks / ((SystemCoreClock >> PROF_PS) / 100));	// Okno 1 s
+	idleTicks = 0;
+}
+
+uint32_t Prof_Us(uint32_t ticks)
+{
+	return (ticks << PROF_PS) / (SystemCoreClock / 1000000);
+}
+
+#if PROF_ENABLE
+void Prof_End(uint8_t id, uint16_t start)
+{
+	volatile ProfStat *s = &profStats[id];
+	uint16_t d = (uint16_t)TPM1->CNT - start;
+
+	if (d < s->min) s->min = d;
+	if (d > s->max) s->max = d;
+	if (s->budget && d > s->budget) s->overruns++;
+	s->sum += d;
+	if (++s->count == 0x10000) {						// Średnia z ostatnich 32k-64k pomiarów, bez przepełnienia sumy
+		s->sum >>= 1;
+		s->count >>= 1;
+	}
+}
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file prof.h
+ * @author Maciej Kucharski
+ * @brief Pomiar czasu przerwań i zadań pętli głównej na liczniku TPM1
+ *				(wolnobieżny, 16 bit, zegar rdzenia / 16). Czas liczony od wejścia
+ *				do wyjścia, łącznie z przerwaniami o wyższym priorytecie.
+ *				Statystyki w profStats - podgląd w oknie Watch debuggera
+ *				albo na stronie diagnostycznej wyświetlacza.
+ */
+
+#ifndef PROF_H
+#define PROF_H
+
+#include "main.h"
+
+#define PROF_ENABLE		1								// 0 - pomiary wyłączone, funkcje puste
+#define PROF_PS				4								// Preskaler TPM1: 2^4, takt ok. 0.38 us, zakres 25 ms
+
+enum {
+	PROF_SAMPLE,												// Zegar próbek (DMA0 lub TPM0) - budżet 1 próbka
+	PROF_RENDER,												// PendSV - budżet 1 blok
+	PROF_PORTA,
+	PROF_PORTB,
+	PROF_I2C,
+	PROF_TSI,
+	PROF_KLAW,													// Takt eliminacji drgań (LPTMR)
+	PROF_LOOP,													// Obieg pętli głównej
+	PROF_LCD,														// Wysłanie zmian na wyświetlacz
+	PROF_COUNT
+};
+
+typedef struct {
+	uint16_t min, max;									// Takty TPM1
+	uint32_t sum;												// Suma do średniej (połowiona razem z count)
+	uint32_t count;
+	uint32_t overruns;									// Przekroczenia budżetu
+	uint16_t budget;										// 0 - bez limitu
+} ProfStat;
+
+extern volatile ProfStat profStats[PROF_COUNT];
+extern volatile uint8_t profIdle;					// % czasu rdzenia w uśpieniu (WFI) w ostatniej sekundzie
+
+/**
+ * @brief Start licznika TPM1 i budżety czasu.
+ */
+void Prof_Init(void);
+/**
+ * @brief Zerowanie min/max/średnich i przekroczeń.
+ */
+void Prof_Reset(void);
+/**
+ * @brief Średnia w taktach TPM1.
+ */
+uint16_t Prof_Avg(uint8_t id);
+/**
+ * @brief Przeliczenie taktów TPM1 na mikrosekundy.
+ */
+uint32_t Prof_Us(uint32_t ticks);
+
+/**
+ * @brief Uśpienie do przerwania (WFI) z pomiarem czasu bezczynności.
+ *				Wołane z wyłączonymi przerwaniami - obsługa po powrocie.
+ */
+void Prof_Sleep(void);
+/**
+ * @brief Takt systemowy (SysTick) - co TICK_RATE taktów nowy profIdle.
+ */
+void Prof_Tick(void);
+
+#if PROF_ENABLE
+/**
+ * @brief Znacznik czasu wejścia.
+ */
+__STATIC_INLINE uint16_t Prof_Now(void)
+{
+	return (uint16_t)TPM1->CNT;
+}
+/**
+ * @brief Koniec pomiaru - aktualizacja statystyk (ok. 30 cykli).
+ *
+ * @param Numer pomiaru PROF_*.
+ * @param Znacznik z Prof_Now() przy wejściu.
+ */
+void Prof_End(uint8_t id, uint16_t start);
+#else
+__STATIC_INLINE uint16_t Prof_Now(void) { return 0; }
+__STATIC_INLINE void Prof_End(uint8_t id, uint16_t start) { (void)id; (void)start; }
+#endif
+
+#endif /* PROF_H */
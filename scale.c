@@ -0,0 +1,86 @@
+#include "scale.h"
+
+typedef struct {
+	const char *name;
+	const uint8_t *snap;								// Tablica przyciągania, 0 - skala chromatyczna
+} Scale;
+
+static const Scale scales[SCALE_COUNT] = {
+	{ "chr", 0 },
+	{ "dur", scaleMajor },
+	{ "mol", scaleMinor },
+	{ "pen", scalePentatonic },
+	{ "blu", scaleBlues },
+	{ "wla", scaleUser }
+};
+
+static const Scale *scale = &scales[SCALE_CHROMATIC];
+static uint8_t root;										// Tonika (półtony od C)
+static uint8_t range = 1;								// Oktawy na pełne wychylenie
+static uint8_t last;										// Ostatni stopień (półton od toniki) - histereza
+
+void Scale_Select(uint8_t sel)
+{
+	if (sel >= SCALE_COUNT) sel = SCALE_COUNT - 1;
+	scale = &scales[sel];
+}
+
+void Scale_SetRoot(uint8_t r)
+{
+	root = (r < 12) ? r : 11;
+}
+
+void Scale_SetRange(uint8_t octaves)
+{
+	if (octaves < 1) octaves = 1;
+	if (octaves > SCALE_RANGE_MAX) octaves = SCALE_RANGE_MAX;
+	range = octaves;
+}
+
+uint8_t Scale_Root(void)
+{
+	return root;
+}
+
+uint8_t Scale_Range(void)
+{
+	return range;
+}
+
+const char *Scale_Name(uint8_t sel)
+{
+	return scales[sel < SCALE_COUNT ? sel : SCALE_COUNT - 1].name;
+}
+
+/**
+ * @brief Indeks tablicy przyciągania dla wysokości ograniczonej do zakresu.
+ */
+static uint8_t scale_step(int32_t p, int32_t max)
+{
+	if (p < 0) p = 0;
+	if (p > max) p = max;
+	return (uint8_t)(p >> SCALE_STEP_SHIFT);
+}
+
+uint16_t Scale_Pitch(int16_t accelX)
+{
+	// 6 półtonów na 1 g (4096) razy zakres: Q8 = range * (1664 + x * 6 * 256 / 4096)
+	int32_t max = (int32_t)(range * 12) << 8;
+	int32_t p = range * (SCALE_CENTER + ((accelX * 3) >> 3));
+	const uint8_t *snap = scale->snap;
+
+	if (p < 0) p = 0;
+	if (p > max) p = max;
+	if (snap) {
+		uint8_t s = snap[p >> SCALE_STEP_SHIFT];
+		if (s != last) {
+			// Nowy stopień dopiero po przejściu granicy o histerezę
+			int32_t back = (s > last) ? p - SCALE_HYST : p + SCALE_HYST;
+			if (snap[scale_step(back, max)] == last)
+				s = last;
+		}
+		last = s;
+		p = (int32_t)s << 8;
+	}
+	return (uint16_t)(p + (root << 8));
+}
@@ -0,0 +1,78 @@
+/**
+ * @file scale.h
+ * @author Maciej Kucharski
+ * @brief Odwzorowanie wychylenia (oś X akcelerometru) na wysokość dźwięku
+ *				z przyciąganiem do stopni skali. Przyciąganie to jeden odczyt z tablicy
+ *				w pamięci Flash (scales.c), zmiana skali to zmiana wskaźnika.
+ */
+
+#ifndef SCALE_H
+#define SCALE_H
+
+#include "main.h"
+
+enum {
+	SCALE_CHROMATIC,										// Bez przyciągania - wysokość ciągła (półtony w glide.c)
+	SCALE_MAJOR,
+	SCALE_MINOR,
+	SCALE_PENTATONIC,
+	SCALE_BLUES,
+	SCALE_USER,													// Własna, ustawiana w tools/gen_scales.py
+	SCALE_COUNT
+};
+
+#define SCALE_RANGE_MAX		3								// Zakres wychylenia w oktawach (1 - 3)
+#define SCALE_STEP_SHIFT	6								// Krok tablicy przyciągania: 1/4 półtonu (Q8 >> 6)
+#define SCALE_STEPS				(((SCALE_RANGE_MAX * 12) << (8 - SCALE_STEP_SHIFT)) + 1)
+#define SCALE_CENTER			(6 * 256 + 128)	// Wysokość przy poziomym ułożeniu (Q8, zakres 1 oktawa)
+#define SCALE_HYST				40							// Histereza zmiany stopnia (Q8, ok. 0,16 półtonu)
+
+// Tablice przyciągania: półton (od toniki) dla wysokości Q8 >> SCALE_STEP_SHIFT
+// (scales.c, generowane przez tools/gen_scales.py)
+extern const uint8_t scaleMajor[SCALE_STEPS];
+extern const uint8_t scaleMinor[SCALE_STEPS];
+extern const uint8_t scalePentatonic[SCALE_STEPS];
+extern const uint8_t scaleBlues[SCALE_STEPS];
+extern const uint8_t scaleUser[SCALE_STEPS];
+
+/**
+ * @brief Wybór skali.
+ *
+ * @param SCALE_*.
+ */
+void Scale_Select(uint8_t scale);
+/**
+ * @brief Tonika - przesunięcie całego zakresu.
+ *
+ * @param Półton względem C (0 - 11).
+ */
+void Scale_SetRoot(uint8_t root);
+/**
+ * @brief Liczba oktaw na pełne wychylenie (1 g w każdą stronę).
+ *
+ * @param 1 - SCALE_RANGE_MAX.
+ */
+void Scale_SetRange(uint8_t octaves);
+/**
+ * @brief Bieżąca tonika (0 - 11).
+ */
+uint8_t Scale_Root(void);
+/**
+ * @brief Bieżący zakres w oktawach (1 - SCALE_RANGE_MAX).
+ */
+uint8_t Scale_Range(void);
+/**
+ * @brief Skrócona nazwa skali do wyświetlacza (3 znaki).
+ */
+const char *Scale_Name(uint8_t scale);
+/**
+ * @brief Wysokość dla odczytu akcelerometru: przekształcenie liniowe,
+ *				ograniczenie do zakresu i jeden odczyt z tablicy skali.
+ *				Wywoływana z pętli głównej.
+ *
+ * @param Oś X (14 bit, 1 g = 4096).
+ * @return Wysokość (półtony Q8 względem C oktawy bieżącej).
+ */
+uint16_t Scale_Pitch(int16_t accelX);
+
+#endif /* SCALE_H */
@@ -0,0 +1,58 @@
+/* Plik generowany przez tools/gen_scales.py - nie edytowac recznie. */
+
+#include "scale.h"
+
+// Durowa: 0 2 4 5 7 9 11
+const uint8_t scaleMajor[SCALE_STEPS] = {
+	 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  4,  4,  4,  4,  4,  4,  5,  5,  5,  5,  5,  5,
+	 7,  7,  7,  7,  7,  7,  7,  7,  9,  9,  9,  9,  9,  9,  9,  9, 11, 11, 11, 11, 11, 11, 12, 12,
+	12, 12, 12, 12, 14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17,
+	19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 21, 21, 21, 21, 23, 23, 23, 23, 23, 23, 24, 24,
+	24, 24, 24, 24, 26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 29, 29, 29, 29, 29, 29,
+	31, 31, 31, 31, 31, 31, 31, 31, 33, 33, 33, 33, 33, 33, 33, 33, 35, 35, 35, 35, 35, 35, 36, 36,
+	36
+};
+
+// Molowa naturalna: 0 2 3 5 7 8 10
+const uint8_t scaleMinor[SCALE_STEPS] = {
+	 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  3,  3,  3,  3,  3,  3,  5,  5,  5,  5,  5,  5,  5,  5,
+	 7,  7,  7,  7,  7,  7,  8,  8,  8,  8,  8,  8, 10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12,
+	12, 12, 12, 12, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 17, 17, 17, 17, 17, 17, 17, 17,
+	19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24,
+	24, 24, 24, 24, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29,
+	31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 34, 34, 34, 34, 34, 34, 34, 34, 36, 36, 36, 36,
+	36
+};
+
+// Pentatonika durowa: 0 2 4 7 9
+const uint8_t scalePentatonic[SCALE_STEPS] = {
+	 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  7,  7,
+	 7,  7,  7,  7,  7,  7,  7,  7,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9, 12, 12, 12, 12, 12, 12,
+	12, 12, 12, 12, 14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 19, 19,
+	19, 19, 19, 19, 19, 19, 19, 19, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 24, 24, 24, 24, 24, 24,
+	24, 24, 24, 24, 26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 31, 31,
+	31, 31, 31, 31, 31, 31, 31, 31, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 36, 36, 36, 36, 36, 36,
+	36
+};
+
+// Bluesowa: 0 3 5 6 7 10
+const uint8_t scaleBlues[SCALE_STEPS] = {
+	 0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  5,  5,  5,  5,  5,  5,  6,  6,
+	 6,  6,  7,  7,  7,  7,  7,  7,  7,  7, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12,
+	12, 12, 12, 12, 12, 12, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 17, 17, 17, 17, 17, 17, 18, 18,
+	18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 30, 30,
+	30, 30, 31, 31, 31, 31, 31, 31, 31, 31, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 36, 36, 36,
+	36
+};
+
+// Wlasna (USER): 0 2 3 5 7 8 11
+const uint8_t scaleUser[SCALE_STEPS] = {
+	 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  3,  3,  3,  3,  3,  3,  5,  5,  5,  5,  5,  5,  5,  5,
+	 7,  7,  7,  7,  7,  7,  8,  8,  8,  8,  8,  8,  8,  8, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12,
+	12, 12, 12, 12, 14, 14, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 17, 17, 17, 17, 17, 17, 17, 17,
+	19, 19, 19, 19, 19, 19, 20, 20, 20, 20, 20, 20, 20, 20, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24,
+	24, 24, 24, 24, 26, 26, 26, 26, 26, 26, 27, 27, 27, 27, 27, 27, 29, 29, 29, 29, 29, 29, 29, 29,
+	31, 31, 31, 31, 31, 31, 32, 32, 32, 32, 32, 32, 32, 32, 35, 35, 35, 35, 35, 35, 35, 35, 36, 36,
+	36
+};
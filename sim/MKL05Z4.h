@@ -0,0 +1,202 @@
+/**
+ * @file MKL05Z4.h
+ * @author Maciej Kucharski
+ * @brief Zastępczy nagłówek CMSIS dla symulatora PC (make sim). Rejestry są
+ *				zwykłymi strukturami w RAM (sim/hw.c) - kod zapisujący je bezpośrednio
+ *				kompiluje się bez zmian, a zachowanie układów (DAC, I2C, TSI) dają
+ *				sterowniki z sim/. Układ pól nie odpowiada adresom w KL05Z.
+ */
+
+#ifndef MKL05Z4_H
+#define MKL05Z4_H
+
+#include <stdint.h>
+
+#define __I			volatile const
+#define __O			volatile
+#define __IO		volatile
+#define __STATIC_INLINE	static inline
+#define __INLINE	inline
+#define __NVIC_PRIO_BITS	2
+
+// Jeden wątek, przerwania wołane synchronicznie przez symulator - blokady są puste
+static inline void __NOP(void) {}
+static inline void __WFI(void) {}
+static inline void __WFE(void) {}
+static inline void __DMB(void) {}
+static inline void __DSB(void) {}
+static inline void __ISB(void) {}
+static inline void __disable_irq(void) {}
+static inline void __enable_irq(void) {}
+static inline uint32_t __get_PRIMASK(void) { return 0; }
+static inline void __set_PRIMASK(uint32_t primask) { (void)primask; }
+
+extern uint32_t SystemCoreClock;
+
+typedef enum {
+	NonMaskableInt_IRQn = -14, HardFault_IRQn = -13, SVCall_IRQn = -5, PendSV_IRQn = -2, SysTick_IRQn = -1,
+	DMA0_IRQn = 0, DMA1_IRQn, DMA2_IRQn, DMA3_IRQn, FTFA_IRQn = 5, LVD_LVW_IRQn, LLW_IRQn, I2C0_IRQn = 8,
+	SPI0_IRQn = 10, UART0_IRQn = 12, ADC0_IRQn = 15, CMP0_IRQn, TPM0_IRQn, TPM1_IRQn, RTC_IRQn = 20,
+	RTC_Seconds_IRQn, PIT_IRQn = 22, DAC0_IRQn = 25, TSI0_IRQn, MCG_IRQn, LPTMR0_IRQn, PORTA_IRQn = 30, PORTB_IRQn
+} IRQn_Type;
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority);
+void NVIC_ClearPendingIRQ(IRQn_Type irq);
+void NVIC_EnableIRQ(IRQn_Type irq);
+void NVIC_DisableIRQ(IRQn_Type irq);
+void NVIC_SetPendingIRQ(IRQn_Type irq);
+uint32_t SysTick_Config(uint32_t ticks);
+
+#define R32 volatile uint32_t
+#define R8 volatile uint8_t
+
+typedef struct { R32 CTRL, LOAD, VAL, CALIB; } SysTick_Type;
+typedef struct { R32 CPUID, ICSR, VTOR, AIRCR, SCR, CCR, SHPR[3], SHCSR; } SCB_Type;
+typedef struct { R32 SOPT1, SOPT2, SOPT4, SOPT5, SOPT7, SDID, SCGC4, SCGC5, SCGC6, SCGC7, CLKDIV1, COPC, SRVCOP; } SIM_Type;
+typedef struct { R32 PCR[32]; R32 GPCLR, GPCHR, ISFR; } PORT_Type;
+typedef struct { R32 PDOR, PSOR, PCOR, PTOR, PDIR, PDDR; } GPIO_Type;
+typedef struct { struct { R8 DATL, DATH; } DAT[2]; R8 SR, C0, C1, C2; } DAC_Type;
+typedef struct { R8 A1, F, C1, S, D, C2, FLT, RA, SMB, A2, SLTH, SLTL; } I2C_Type;
+typedef struct { R32 GENCS, DATA, TSHD; } TSI_Type;
+typedef struct { R32 SC, CNT, MOD; struct { R32 CnSC, CnV; } CONTROLS[6]; R32 STATUS, CONF; } TPM_Type;
+typedef struct { R32 CSR, PSR, CMR, CNR; } LPTMR_Type;
+typedef struct { struct { R32 SAR, DAR, DSR_BCR, DCR; } DMA[4]; } DMA_Type;
+typedef struct { R8 CHCFG[4]; } DMAMUX_Type;
+typedef struct { R8 PMPROT, PMCTRL, STOPCTRL, PMSTAT; } SMC_Type;
+
+extern SysTick_Type simSysTick;
+extern SCB_Type simSCB;
+extern SIM_Type simSIM;
+extern PORT_Type simPORTA, simPORTB;
+extern GPIO_Type simPTA, simPTB;
+extern DAC_Type simDAC0;
+extern I2C_Type simI2C0;
+extern TSI_Type simTSI0;
+extern TPM_Type simTPM0, simTPM1;
+extern LPTMR_Type simLPTMR0;
+extern DMA_Type simDMA0;
+extern DMAMUX_Type simDMAMUX0;
+extern SMC_Type simSMC;
+
+#define SysTick		(&simSysTick)
+#define SCB				(&simSCB)
+#define SIM				(&simSIM)
+#define PORTA			(&simPORTA)
+#define PORTB			(&simPORTB)
+#define PTA				(&simPTA)
+#define PTB				(&simPTB)
+#define DAC0			(&simDAC0)
+#define I2C0			(&simI2C0)
+#define TSI0			(&simTSI0)
+#define TPM0			(&simTPM0)
+#define TPM1			(&simTPM1)
+#define LPTMR0		(&simLPTMR0)
+#define DMA0			(&simDMA0)
+#define DMAMUX0		(&simDMAMUX0)
+#define SMC				(&simSMC)
+
+#define SysTick_CTRL_ENABLE_Msk			1u
+#define SysTick_CTRL_TICKINT_Msk		2u
+#define SysTick_CTRL_CLKSOURCE_Msk	4u
+#define SysTick_CTRL_COUNTFLAG_Msk	(1u << 16)
+#define SysTick_LOAD_RELOAD_Msk			0xFFFFFFu
+#define SCB_ICSR_PENDSVSET_Msk			(1u << 28)
+#define SCB_ICSR_PENDSVCLR_Msk			(1u << 27)
+#define SCB_SCR_SLEEPDEEP_Msk				4u
+#define SCB_SCR_SLEEPONEXIT_Msk			2u
+
+#define SIM_BIT(n)		(1u << (n))
+#define SIM_FLD(v, s)	((uint32_t)(v) << (s))
+#define SIM_SCGC4_I2C0_MASK SIM_BIT(6)
+#define SIM_SCGC4_UART0_MASK SIM_BIT(10)
+#define SIM_SCGC5_PORTA_MASK SIM_BIT(9)
+#define SIM_SCGC5_PORTB_MASK SIM_BIT(10)
+#define SIM_SCGC5_TSI_MASK SIM_BIT(5)
+#define SIM_SCGC5_LPTMR_MASK SIM_BIT(0)
+#define SIM_SCGC6_DAC0_MASK SIM_BIT(31)
+#define SIM_SCGC6_TPM0_MASK SIM_BIT(24)
+#define SIM_SCGC6_TPM1_MASK SIM_BIT(25)
+#define SIM_SCGC6_DMAMUX_MASK SIM_BIT(1)
+#define SIM_SCGC7_DMA_MASK SIM_BIT(8)
+#define SIM_SOPT2_TPMSRC(x) SIM_FLD(x,24)
+#define SIM_SOPT2_TPMSRC_MASK SIM_FLD(3,24)
+#define SIM_SOPT2_UART0SRC(x) SIM_FLD(x,26)
+#define PORT_PCR_MUX(x) SIM_FLD(x,8)
+#define PORT_PCR_PE_MASK SIM_BIT(1)
+#define PORT_PCR_PS_MASK SIM_BIT(0)
+#define PORT_PCR_SRE_MASK SIM_BIT(2)
+#define PORT_PCR_IRQC(x) SIM_FLD(x,16)
+#define PORT_PCR_IRQC_MASK SIM_FLD(15,16)
+#define PORT_PCR_ISF_MASK SIM_BIT(24)
+#define DAC_C0_DACEN_MASK SIM_BIT(7)
+#define DAC_C0_DACRFS_MASK SIM_BIT(6)
+#define DAC_C0_DACTRGSEL_MASK SIM_BIT(5)
+#define DAC_C0_DACSWTRG_MASK SIM_BIT(4)
+#define DAC_C1_DMAEN_MASK SIM_BIT(7)
+#define DAC_C1_DACBFEN_MASK SIM_BIT(0)
+#define I2C_C1_IICEN_MASK SIM_BIT(7)
+#define I2C_C1_IICIE_MASK SIM_BIT(6)
+#define I2C_C1_MST_MASK SIM_BIT(5)
+#define I2C_C1_TX_MASK SIM_BIT(4)
+#define I2C_C1_TXAK_MASK SIM_BIT(3)
+#define I2C_C1_RSTA_MASK SIM_BIT(2)
+#define I2C_S_TCF_MASK SIM_BIT(7)
+#define I2C_S_BUSY_MASK SIM_BIT(5)
+#define I2C_S_ARBL_MASK SIM_BIT(4)
+#define I2C_S_IICIF_MASK SIM_BIT(1)
+#define I2C_S_RXAK_MASK SIM_BIT(0)
+#define I2C_FLT_STOPF_MASK SIM_BIT(6)
+#define I2C_FLT_STOPIE_MASK SIM_BIT(5)
+#define I2C_F_MULT(x) SIM_FLD(x,6)
+#define I2C_F_ICR(x) SIM_FLD(x,0)
+#define TSI_GENCS_ESOR_MASK SIM_BIT(28)
+#define TSI_GENCS_MODE(x) SIM_FLD(x,24)
+#define TSI_GENCS_REFCHRG(x) SIM_FLD(x,21)
+#define TSI_GENCS_DVOLT(x) SIM_FLD(x,19)
+#define TSI_GENCS_EXTCHRG(x) SIM_FLD(x,16)
+#define TSI_GENCS_PS(x) SIM_FLD(x,13)
+#define TSI_GENCS_NSCN(x) SIM_FLD(x,8)
+#define TSI_GENCS_TSIEN_MASK SIM_BIT(7)
+#define TSI_GENCS_TSIIEN_MASK SIM_BIT(6)
+#define TSI_GENCS_STPE_MASK SIM_BIT(5)
+#define TSI_GENCS_STM_MASK SIM_BIT(4)
+#define TSI_GENCS_SCNIP_MASK SIM_BIT(3)
+#define TSI_GENCS_EOSF_MASK SIM_BIT(2)
+#define TSI_DATA_TSICH_SHIFT 28
+#define TSI_DATA_TSICH(x) SIM_FLD(x,28)
+#define TSI_DATA_DMAEN_MASK SIM_BIT(23)
+#define TSI_DATA_SWTS_MASK SIM_BIT(22)
+#define TSI_DATA_TSICNT_MASK 0xFFFFu
+#define TPM_SC_DMA_MASK SIM_BIT(8)
+#define TPM_SC_TOF_MASK SIM_BIT(7)
+#define TPM_SC_TOIE_MASK SIM_BIT(6)
+#define TPM_SC_CMOD(x) SIM_FLD(x,3)
+#define TPM_SC_CMOD_MASK SIM_FLD(3,3)
+#define TPM_SC_PS(x) SIM_FLD(x,0)
+#define TPM_CNT_COUNT_MASK 0xFFFFu
+#define TPM_MOD_MOD(x) SIM_FLD(x,0)
+#define LPTMR_CSR_TCF_MASK SIM_BIT(7)
+#define LPTMR_CSR_TIE_MASK SIM_BIT(6)
+#define LPTMR_CSR_TEN_MASK SIM_BIT(0)
+#define LPTMR_PSR_PCS(x) SIM_FLD(x,0)
+#define LPTMR_PSR_PBYP_MASK SIM_BIT(2)
+#define LPTMR_CMR_COMPARE(x) SIM_FLD(x,0)
+#define DMA_DSR_BCR_DONE_MASK SIM_BIT(24)
+#define DMA_DSR_BCR_BSY_MASK SIM_BIT(25)
+#define DMA_DSR_BCR_BCR(x) SIM_FLD(x,0)
+#define DMA_DSR_BCR_BCR_MASK 0xFFFFFu
+#define DMA_DCR_EINT_MASK SIM_BIT(31)
+#define DMA_DCR_ERQ_MASK SIM_BIT(30)
+#define DMA_DCR_CS_MASK SIM_BIT(29)
+#define DMA_DCR_SINC_MASK SIM_BIT(22)
+#define DMA_DCR_SSIZE(x) SIM_FLD(x,20)
+#define DMA_DCR_DINC_MASK SIM_BIT(19)
+#define DMA_DCR_DSIZE(x) SIM_FLD(x,17)
+#define DMA_DCR_SMOD(x) SIM_FLD(x,12)
+#define DMA_DCR_DMOD(x) SIM_FLD(x,8)
+#define DMA_DCR_D_REQ_MASK SIM_BIT(7)
+#define DMAMUX_CHCFG_ENBL_MASK SIM_BIT(7)
+#define DMAMUX_CHCFG_TRIG_MASK SIM_BIT(6)
+#define DMAMUX_CHCFG_SOURCE(x) SIM_FLD(x,0)
+
+#endif /* MKL05Z4_H */
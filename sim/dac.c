@@ -0,0 +1,99 @@
+/**
+ * @file dac.c
+ * @author Maciej Kucharski
+ * @brief DAC.h dla symulatora - strumień "grany" przez harmonogram (sim.c),
+ *				zagrane połówki bufora trafiają do odbiornika.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#include "DAC.h"
+#include "sim.h"
+#include "hal.h"
+#include "audio.h"
+
+uint64_t simRenderNs;
+uint32_t simRenderBlocks;
+
+static const uint16_t *streamBuf;
+static uint32_t streamHalf;					// Próbek w połowie bufora
+static uint32_t streamRate;
+static uint8_t streamPos;						// Połowa właśnie grana
+static void (*streamHalfDone)(void);
+static Sim_Sink sink;
+static void *sinkCtx;
+
+void DAC_Init(void)
+{
+}
+
+uint8_t DAC_Load_Trig(uint16_t load)
+{
+	if (load > 0xFFF) return (1);
+	DAC0->DAT[0].DATL = load & 0xFF;
+	DAC0->DAT[0].DATH = load >> 8;
+	if (sink) sink(&load, 1, sinkCtx);
+	return (0);
+}
+
+void DAC_Stream_Start(const uint16_t *buf, uint16_t samples, uint32_t rate, void (*halfDone)(void))
+{
+	streamBuf = buf;
+	streamHalf = samples / 2;
+	streamRate = rate;
+	streamPos = 0;
+	streamHalfDone = halfDone;
+}
+
+void DAC_Clock_Start(uint32_t rate)
+{
+	streamBuf = 0;										// Bez DMA - próbki z TPM0_IRQHandler przez DAC_Load_Trig
+	streamHalf = AUDIO_BLOCK;					// Harmonogram co blok, jak przy strumieniu
+	streamRate = rate;
+	streamPos = 0;
+	streamHalfDone = 0;
+}
+
+void Sim_DacSink(Sim_Sink s, void *ctx)
+{
+	sink = s;
+	sinkCtx = ctx;
+}
+
+uint32_t Sim_DacRate(void)
+{
+	return streamRate;
+}
+
+uint32_t Sim_DacHalf(void)
+{
+	return streamHalf;
+}
+
+void Sim_DacBlock(void)
+{
+	struct timespec t0, t1;
+
+#if !AUDIO_USE_DMA
+	uint32_t i;
+
+	if (!streamBuf) {
+		for (i = 0; i < streamHalf; i++)
+			TPM0_IRQHandler();						// Przerwanie TPM0 na każdą próbkę
+	} else
+#endif
+	{
+		if (sink) sink(streamBuf + streamPos * streamHalf, streamHalf, sinkCtx);
+		streamPos ^= 1;
+		streamHalfDone();								// Przerwanie DMA0 po połowie bufora
+	}
+
+	if (SCB->ICSR & SCB_ICSR_PENDSVSET_Msk) {
+		SCB->ICSR = 0;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		PendSV_Handler();
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		simRenderNs += (uint64_t)(t1.tv_sec - t0.tv_sec) * 1000000000u + (t1.tv_nsec - t0.tv_nsec);
+		simRenderBlocks++;
+	}
+}
@@ -0,0 +1,107 @@
+/**
+ * @file hw.c
+ * @author Maciej Kucharski
+ * @brief Rejestry układów KL05Z jako struktury w RAM, NVIC i piny GPIO symulatora.
+ */
+
+#include "MKL05Z4.h"
+#include "sim.h"
+#include "hal.h"
+
+uint32_t SystemCoreClock = 41943040;
+
+SysTick_Type simSysTick;
+SCB_Type simSCB;
+SIM_Type simSIM;
+PORT_Type simPORTA, simPORTB;
+GPIO_Type simPTA = { .PDIR = 0xFFFFFFFF };		// Podciągnięcia - linie w stanie wysokim
+GPIO_Type simPTB = { .PDIR = 0xFFFFFFFF };
+DAC_Type simDAC0;
+I2C_Type simI2C0;
+TSI_Type simTSI0;
+TPM_Type simTPM0, simTPM1;
+LPTMR_Type simLPTMR0;
+DMA_Type simDMA0;
+DMAMUX_Type simDMAMUX0;
+SMC_Type simSMC;
+
+static uint32_t nvicEnabled;
+static uint8_t lptmrTcf;								// TCF osobno - w RAM zapis jedynki go nie kasuje
+uint32_t simLptmrTrig;
+
+void NVIC_SetPriority(IRQn_Type irq, uint32_t priority) { (void)irq; (void)priority; }
+void NVIC_ClearPendingIRQ(IRQn_Type irq) { (void)irq; }
+void NVIC_EnableIRQ(IRQn_Type irq) { if (irq >= 0) nvicEnabled |= 1u << irq; }
+void NVIC_DisableIRQ(IRQn_Type irq) { if (irq >= 0) nvicEnabled &= ~(1u << irq); }
+void NVIC_SetPendingIRQ(IRQn_Type irq) { (void)irq; }
+
+uint32_t SysTick_Config(uint32_t ticks)
+{
+	SysTick->LOAD = ticks - 1;
+	SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+	return 0;
+}
+
+void Sim_Pin(uint8_t port, uint8_t pin, uint8_t level)
+{
+	PORT_Type *pcr = port ? PORTB : PORTA;
+	GPIO_Type *gpio = port ? PTB : PTA;
+	uint32_t mask = 1u << pin;
+	uint8_t old = (gpio->PDIR & mask) != 0;
+	uint8_t irqc = (pcr->PCR[pin] >> 16) & 0xF;
+
+	if (level) gpio->PDIR |= mask;
+	else gpio->PDIR &= ~mask;
+	if (old == level) return;
+
+	// IRQC: 0x9 - zbocze narastające, 0xA - opadające, 0xB - oba
+	if ((irqc == 0xB) || (irqc == 0xA && !level) || (irqc == 0x9 && level)) {
+		// ISFR w RAM nie ma kasowania zapisem jedynki - flaga tylko na czas obsługi
+		pcr->ISFR = mask;
+		if (nvicEnabled & (1u << (port ? PORTB_IRQn : PORTA_IRQn))) {
+			if (port) PORTB_IRQHandler();
+			else PORTA_IRQHandler();
+		}
+		pcr->ISFR = 0;
+	}
+}
+
+/**
+ * @brief Zapis jedynki do TCF kasuje flagę porównania.
+ */
+static void lptmr_w1c(void)
+{
+	if (LPTMR0->CSR & LPTMR_CSR_TCF_MASK) {
+		LPTMR0->CSR &= ~LPTMR_CSR_TCF_MASK;
+		lptmrTcf = 0;
+	}
+}
+
+void Sim_Lptmr(void)
+{
+	lptmr_w1c();
+	if (!(LPTMR0->CSR & LPTMR_CSR_TEN_MASK)) {
+		LPTMR0->CNR = 0;								// Wyłączenie zeruje licznik
+		lptmrTcf = 0;
+		return;
+	}
+	if (lptmrTcf) {
+		LPTMR0->CNR = 0;								// TFC = 0: licznik stoi, dopóki TCF nie skasowane
+		return;
+	}
+	if (LPTMR0->CNR++ < LPTMR0->CMR) return;
+	LPTMR0->CNR = 0;
+	lptmrTcf = 1;
+	simLptmrTrig++;										// Wyzwolenie sprzętowe skanu TSI
+	if ((LPTMR0->CSR & LPTMR_CSR_TIE_MASK) && (nvicEnabled & (1u << LPTMR0_IRQn))) {
+		LPTMR0_IRQHandler();
+		lptmr_w1c();
+	}
+}
+
+void Sim_Button(uint32_t mask, uint8_t pressed)
+{
+	for (uint8_t pin = 0; pin < 32; pin++)
+		if (mask & (1u << pin))
+			Sim_Pin(1, pin, !pressed);		// Przycisk zwiera do masy
+}
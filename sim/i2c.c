@@ -0,0 +1,115 @@
+/**
+ * @file i2c.c
+ * @author Maciej Kucharski
+ * @brief i2c.h dla symulatora - transfer wykonywany od razu w I2C_Submit
+ *				na wirtualnej magistrali, wywołanie zwrotne jak z przerwania I2C0.
+ */
+
+#include "i2c.h"
+#include "sim.h"
+
+uint32_t simI2cXfers;
+uint32_t simI2cBytes;
+uint8_t simI2cFailAddr;
+uint32_t simI2cFail;
+
+static const Sim_I2cDev *const bus[] = { &simMma8451q, &simPcf8574 };
+
+static const Sim_I2cDev *i2c_dev(uint8_t address)
+{
+	for (uint8_t i = 0; i < sizeof(bus) / sizeof(bus[0]); i++)
+		if (bus[i]->address == address) return bus[i];
+	return 0;
+}
+
+void I2C_Init(void)
+{
+}
+
+uint8_t I2C_Submit(I2C_Xfer *xfer)
+{
+	const Sim_I2cDev *dev = i2c_dev(xfer->address);
+	uint8_t i;
+
+	simI2cXfers++;
+	simI2cBytes++;													// Adres
+	xfer->error = 0;
+	if (simI2cFail && xfer->address == simI2cFailAddr) {
+		simI2cFail--;
+		dev = 0;															// Brak ACK na adresie, nic nie dochodzi
+	}
+	if (!dev) {
+		xfer->error = I2C_ERR_NOACK;
+	} else {
+		if ((xfer->flags & (I2C_XFER_REG | I2C_XFER_READ)) != I2C_XFER_READ) {
+			dev->start(0);
+			if (xfer->flags & I2C_XFER_REG) {
+				dev->write(xfer->reg);
+				simI2cBytes++;
+			}
+		}
+		if (xfer->flags & I2C_XFER_READ) {
+			dev->start(1);												// Powtórzony START
+			if (xfer->flags & I2C_XFER_REG) simI2cBytes++;
+			for (i = 0; i < xfer->size; i++) xfer->data[i] = dev->read();
+		} else {
+			for (i = 0; i < xfer->size; i++) dev->write(xfer->data[i]);
+		}
+		simI2cBytes += xfer->size;
+		dev->stop();
+	}
+	xfer->state = I2C_XFER_DONE;
+	if (xfer->callback) xfer->callback(xfer);
+	return 0;
+}
+
+uint8_t I2C_Busy(void)
+{
+	return 0;
+}
+
+void I2C_Poll(void)
+{
+}
+
+static uint8_t i2c_sync(uint8_t address, uint8_t reg, uint8_t flags, uint8_t size, uint8_t *data)
+{
+	I2C_Xfer x = { address, reg, flags, size, data, 0, I2C_XFER_IDLE, 0 };
+	I2C_Submit(&x);
+	return x.error;
+}
+
+uint8_t I2C_Ping(uint8_t address)
+{
+	return i2c_sync(address, 0, 0, 0, 0);
+}
+
+uint8_t I2C_Write(uint8_t address, uint8_t data)
+{
+	return i2c_sync(address, 0, 0, 1, &data);
+}
+
+uint8_t I2C_WriteBlock(uint8_t address, uint8_t size, uint8_t* data)
+{
+	return i2c_sync(address, 0, 0, size, data);
+}
+
+uint8_t I2C_Read(uint8_t address, uint8_t* data)
+{
+	return i2c_sync(address, 0, I2C_XFER_READ, 1, data);
+}
+
+uint8_t I2C_WriteReg(uint8_t address, uint8_t reg, uint8_t data)
+{
+	return i2c_sync(address, reg, I2C_XFER_REG, 1, &data);
+}
+
+uint8_t I2C_ReadReg(uint8_t address, uint8_t reg, uint8_t* data)
+{
+	return i2c_sync(address, reg, I2C_XFER_REG | I2C_XFER_READ, 1, data);
+}
+
+uint8_t I2C_ReadRegBlock(uint8_t address, uint8_t reg, uint8_t size, uint8_t* data)
+{
+	return i2c_sync(address, reg, I2C_XFER_REG | I2C_XFER_READ, size, data);
+}
@@ -0,0 +1,102 @@
+/**
+ * @file lcd.c
+ * @author Maciej Kucharski
+ * @brief Wirtualny ekspander PCF8574 (adres 0x27) z wyświetlaczem HD44780
+ *				w trybie 4 bit: P0 RS, P1 RW, P2 EN, P3 podświetlenie, P4-P7 D4-D7.
+ *				Instrukcja/dana zapisywana przy opadającym EN, flaga zajętości zawsze 0.
+ */
+
+#include <string.h>
+#include "sim.h"
+
+#define PCF_ADDR		0x27
+#define PIN_RS			0x01
+#define PIN_RW			0x02
+#define PIN_EN			0x04
+
+static uint8_t pins;
+static uint8_t rw;										// RW zatrzaśnięty przy narastającym EN
+static uint8_t eightBit = 1;					// Po włączeniu zasilania interfejs 8 bit
+static int16_t upper = -1;						// Starsza połowa bajtu w trybie 4 bit
+static uint8_t readLow;								// Odczyt BF/AC: druga połowa
+static uint8_t ac;
+static uint8_t cgram;									// Adres w CGRAM - dane nie trafiają do DDRAM
+static char ddram[0x80];
+static char row[17];
+
+static void lcd_exec(uint8_t data, uint8_t rs)
+{
+	if (rs) {
+		if (!cgram) ddram[ac & 0x7F] = (char)data;
+		ac = (ac + 1) & 0x7F;
+	} else if (data & 0x80) {
+		ac = data & 0x7F;
+		cgram = 0;
+	} else if (data & 0x40) {
+		ac = data & 0x3F;
+		cgram = 1;
+	} else if (data & 0x20) {
+		eightBit = (data & 0x10) != 0;		// Function set: DL
+	} else if (data == 0x01) {
+		memset(ddram, ' ', sizeof(ddram));
+		ac = 0;
+		cgram = 0;
+	} else if ((data & 0xFE) == 0x02) {
+		ac = 0;
+		cgram = 0;
+	}
+}
+
+static void lcd_pins(uint8_t p)
+{
+	uint8_t nibble = p >> 4;
+
+	if (!(pins & PIN_EN) && (p & PIN_EN)) {
+		rw = p & PIN_RW;
+		if (rw) {															// D4-D7 wystawiane przez wyświetlacz
+			nibble = readLow ? (ac & 0x0F) : ((ac >> 4) & 0x07);
+			readLow ^= 1;
+			p = (p & 0x0F) | (uint8_t)(nibble << 4);
+		}
+	}
+	if ((pins & PIN_EN) && !(p & PIN_EN) && !rw) {
+		if (eightBit) {
+			lcd_exec((uint8_t)(nibble << 4), pins & PIN_RS);
+			upper = -1;
+		} else if (upper < 0) {
+			upper = nibble;
+		} else {
+			lcd_exec((uint8_t)((upper << 4) | nibble), pins & PIN_RS);
+			upper = -1;
+		}
+	}
+	pins = p;
+}
+
+static void pcf_start(uint8_t read)
+{
+	(void)read;
+}
+
+static void pcf_write(uint8_t data)
+{
+	lcd_pins(data);
+}
+
+static uint8_t pcf_read(void)
+{
+	return pins;
+}
+
+static void pcf_stop(void)
+{
+}
+
+const Sim_I2cDev simPcf8574 = { PCF_ADDR, pcf_start, pcf_write, pcf_read, pcf_stop };
+
+const char *Sim_LcdRow(uint8_t r)
+{
+	memcpy(row, &ddram[r ? 0x40 : 0x00], 16);
+	row[16] = '\0';
+	return row;
+}
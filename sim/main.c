@@ -0,0 +1,149 @@
+/**
+ * @file main.c
+ * @author Maciej Kucharski
+ * @brief Symulator PC - scenariusz: wychylenia płytki, przyciski i slider.
+ *				Na końcu stan wyświetlacza, ruch na I2C, suma kontrolna próbek
+ *				(porównanie między wersjami) i czas renderowania na PC. Kształt
+ *				fali i oktawa muszą odpowiadać naciśnięciom S4 i S2/S3, a ostatnia
+ *				sekunda (najwyższa oktawa, pełne wychylenie) nie może przekroczyć
+ *				fs/2 - inaczej kod wyjścia 1.
+ *
+ *				make run              - 10 s scenariusza
+ *				build/synth-sim 60    - dłuższy przebieg (pomiar wydajności)
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "sim.h"
+#include "audio.h"
+#include "klaw.h"
+#include "evlog.h"
+#include "event.h"
+#include "main.h"
+#include "voice.h"
+#include "env.h"
+
+// Stan aplikacji (main.c) - sprawdzenie, że naciśnięcia zadziałały
+extern volatile uint8_t waveForm;
+extern volatile int8_t octave;
+int8_t Octave_Top(void);
+
+typedef struct {
+	uint64_t count;
+	uint32_t hash;						// FNV-1a próbek
+	uint16_t min, max;
+} Capture;
+
+static void capture(const uint16_t *samples, uint32_t count, void *ctx)
+{
+	Capture *c = ctx;
+	for (uint32_t i = 0; i < count; i++) {
+		uint16_t s = samples[i];
+		c->hash = (c->hash ^ (s & 0xFF)) * 16777619u;
+		c->hash = (c->hash ^ (s >> 8)) * 16777619u;
+		if (s < c->min) c->min = s;
+		if (s > c->max) c->max = s;
+	}
+	c->count += count;
+}
+
+// Najwyższe słowo strojenia grających głosów
+static uint32_t top_word(void)
+{
+	uint32_t w = 0;
+	for (uint8_t v = 0; v < VOICE_COUNT; v++)
+		if (voices.envStage[v] != ENV_IDLE && voices.tuningWord[v] > w) w = voices.tuningWord[v];
+	return w;
+}
+
+// Wychylenie: piła od -1g do +1g co 4 s - przejście przez całą skalę
+static int16_t tilt(uint64_t t, uint32_t rate)
+{
+	uint32_t ms = (uint32_t)(t * 1000 / rate) % 4000;
+	return (int16_t)(-4096 + (int32_t)ms * 8192 / 4000);
+}
+
+static void press(uint32_t mask)
+{
+	Sim_Button(mask, 1);
+	Sim_Advance(Sim_DacRate() / 20);	// 50 ms
+	Sim_Button(mask, 0);
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t seconds = (argc > 1) ? (uint32_t)atoi(argv[1]) : 10;
+	Capture cap = { 0, 2166136261u, 0xFFFF, 0 };
+	struct timespec t0, t1;
+	uint32_t rate, step;
+	uint8_t wave = 0;									// Oczekiwany stan po naciśnięciach
+	int8_t oct = 0;
+	uint32_t word = 0;								// Najwyższe słowo strojenia
+	uint8_t top = 0;
+	double wall;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	Sim_Init();
+	Sim_DacSink(capture, &cap);
+	rate = Sim_DacRate();
+	step = rate / 100;								// Wejścia zmieniane co 10 ms
+
+	for (uint32_t n = 0; simTime < (uint64_t)seconds * rate; n++) {
+		if (!top && simTime + rate >= (uint64_t)seconds * rate) {	// Ostatnia sekunda: szczyt zakresu
+			top = 1;
+			for (int8_t i = 0; i < OCTAVE_COUNT; i++) {
+				press(S2_MASK);
+				Sim_Advance(rate / 20);			// Zwolnienie po debouncingu
+			}
+			oct = Octave_Top();
+		}
+		Sim_AccelTilt(top ? 4096 : tilt(simTime, rate));
+		if (n % 250 == 200) {									// Zmiana kształtu fali
+			press(S4_MASK);
+			wave = (wave + 1) % 3;
+		}
+		if (n % 500 == 250) press(S1_MASK);		// Kolejny parametr slidera
+		if (n % 700 == 350) {									// Oktawa w górę / w dół na zmianę
+			uint8_t down = (n / 700) & 1;
+			press(down ? S3_MASK : S2_MASK);
+			if (down && oct > OCTAVE_MIN) oct--;
+			if (!down && oct < Octave_Top()) oct++;
+		}
+		Sim_TsiTouch((n % 1000 > 900) ? 40 : 0);
+		Sim_Advance(step);
+		if (top_word() > word) word = top_word();
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	wall = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+	printf("LCD:   [%s]\n", Sim_LcdRow(0));
+	printf("       [%s]\n", Sim_LcdRow(1));
+	printf("audio: %llu probek @ %u Hz, zakres %u..%u, suma %08x, niedobory %u\n",
+			(unsigned long long)cap.count, (unsigned)rate, cap.min, cap.max, (unsigned)cap.hash, (unsigned)audioUnderruns);
+	printf("ton:   najwyzszy %u Hz, fs/2 %u Hz\n", (unsigned)(((uint64_t)word * rate + (1u << 31)) >> 32),
+			(unsigned)(rate / 2));
+#if EVLOG_ENABLE
+	printf("log:   %u zdarzen, %u/%u blokow, %u bajtow, utracone w kolejce %u\n", (unsigned)evLog.events,
+			evLog.filled, evLog.chunks, (unsigned)sizeof(evLog), (unsigned)eventsLost);
+#else
+	printf("log:   wylaczony, utracone w kolejce %u\n", (unsigned)eventsLost);
+#endif
+	printf("I2C:   %u transakcji (%.1f/s), %u bajtow\n",
+			(unsigned)simI2cXfers, simI2cXfers / (double)seconds, (unsigned)simI2cBytes);
+	if (simRenderBlocks)
+		printf("blok:  %u x %u probek, %.0f ns/blok, %.2f%% budzetu czasu rzeczywistego\n",
+				(unsigned)simRenderBlocks, (unsigned)AUDIO_BLOCK, simRenderNs / (double)simRenderBlocks,
+				100.0 * simRenderNs / simRenderBlocks / (1e9 * AUDIO_BLOCK / rate));
+	printf("czas:  %.3f s na PC, %.0fx czas rzeczywisty\n", wall, seconds / wall);
+	if (waveForm != wave || octave != oct) {
+		printf("BLAD:  fala %u, oktawa %d - oczekiwane %u, %d\n", waveForm, octave, wave, oct);
+		return 1;
+	}
+	if (word >= 0x80000000u) {
+		printf("BLAD:  ton powyzej fs/2\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * @file mma8451q.c
+ * @author Maciej Kucharski
+ * @brief Wirtualny MMA8451Q (adres 0x1D): rejestry, tryb F_READ, FIFO
+ *				z progiem i przerwanie FIFO na INT2 (PTA10, aktywne niskim).
+ */
+
+#include "sim.h"
+#include "accel.h"
+
+#define REG_STATUS		0x00					// DR_STATUS lub F_STATUS gdy FIFO włączone
+#define REG_OUT_X_MSB	0x01
+#define REG_OUT_Z_LSB	0x06
+#define REG_F_SETUP		0x09
+#define REG_WHO_AM_I	0x0D
+#define REG_CTRL1			0x2A
+#define REG_CTRL4			0x2D
+#define REG_CTRL5			0x2E
+#define FIFO_LEN			32
+
+static uint8_t reg[0x32] = { [REG_WHO_AM_I] = 0x1A };
+static uint8_t ptr;
+static uint8_t first;								// Pierwszy bajt zapisu = adres rejestru
+static int16_t tiltX;
+static int16_t fifo[FIFO_LEN][3];
+static uint8_t fifoCount;
+static uint8_t fifoOvf;
+static int16_t out[3];								// Próbka czytana z rejestrów wyjściowych
+static uint8_t dataReady;
+
+static uint8_t mma_fifo(void)
+{
+	return (reg[REG_F_SETUP] >> 6) != 0;
+}
+
+// INT2 wg stanu FIFO - wywoływane po próbce i po zakończeniu transakcji
+static void mma_int(void)
+{
+	uint8_t wmrk = reg[REG_F_SETUP] & 0x3F;
+	uint8_t active = mma_fifo() && (reg[REG_CTRL4] & 0x40) && wmrk && (fifoCount >= wmrk);
+	if (reg[REG_CTRL5] & 0x40) active = 0;	// Przerwanie FIFO skierowane na INT1 (niepodłączone)
+	Sim_Pin(0, ACCEL_INT_PIN, !active);
+}
+
+static void mma_start(uint8_t read)
+{
+	first = !read;
+}
+
+static void mma_write(uint8_t data)
+{
+	if (first) {
+		ptr = data;
+		first = 0;
+		return;
+	}
+	if (ptr < sizeof(reg)) reg[ptr] = data;
+	if (ptr == REG_F_SETUP && !mma_fifo()) fifoCount = 0;
+	ptr++;
+}
+
+static uint8_t mma_read(void)
+{
+	uint8_t v, r = ptr;
+
+	if (r == REG_STATUS) {
+		if (mma_fifo()) {
+			uint8_t wmrk = reg[REG_F_SETUP] & 0x3F;
+			v = fifoCount | (fifoOvf ? 0x80 : 0) | ((wmrk && fifoCount >= wmrk) ? 0x40 : 0);
+		} else {
+			v = dataReady ? 0x0F : 0;
+		}
+	} else if (r >= REG_OUT_X_MSB && r <= REG_OUT_Z_LSB) {
+		if (r == REG_OUT_X_MSB && mma_fifo() && fifoCount) {	// Kolejna próbka z FIFO
+			for (uint8_t i = 0; i < 3; i++) out[i] = fifo[0][i];
+			for (uint8_t i = 1; i < fifoCount; i++)
+				for (uint8_t a = 0; a < 3; a++) fifo[i - 1][a] = fifo[i][a];
+			fifoCount--;
+			fifoOvf = 0;
+		}
+		uint16_t val = (uint16_t)out[(r - 1) / 2] << 2;	// 14 bit wyrównane do lewej
+		v = (r & 1) ? (uint8_t)(val >> 8) : (uint8_t)val;
+		dataReady = 0;
+	} else {
+		v = (r < sizeof(reg)) ? reg[r] : 0;
+	}
+
+	// Autoinkrementacja: F_READ pomija LSB, w trybie FIFO po OUT_Z_LSB powrót do OUT_X_MSB
+	if (r == REG_STATUS) ptr = REG_OUT_X_MSB;
+	else if (r >= REG_OUT_X_MSB && r <= REG_OUT_Z_LSB) {
+		if (reg[REG_CTRL1] & 0x02) ptr = (r == 0x05) ? 0x00 : r + 2;
+		else if (r == REG_OUT_Z_LSB) ptr = mma_fifo() ? REG_OUT_X_MSB : 0x07;
+		else ptr = r + 1;
+	}
+	else ptr = r + 1;
+	return v;
+}
+
+static void mma_stop(void)
+{
+	mma_int();
+}
+
+const Sim_I2cDev simMma8451q = { ACCEL_ADDR, mma_start, mma_write, mma_read, mma_stop };
+
+void Sim_AccelTilt(int16_t x)
+{
+	tiltX = x;
+}
+
+uint32_t Sim_AccelOdr(void)
+{
+	static const uint32_t odr[8] = { 800000, 400000, 200000, 100000, 50000, 12500, 6250, 1563 };
+	if (!(reg[REG_CTRL1] & 0x01)) return 0;		// Standby
+	return odr[(reg[REG_CTRL1] >> 3) & 0x7];
+}
+
+void Sim_AccelSample(void)
+{
+	int16_t s[3] = { tiltX, 0, 4096 };			// Płytka poziomo w osi Y, Z = 1g
+
+	for (uint8_t i = 0; i < 3; i++) out[i] = s[i];
+	dataReady = 1;
+	if (mma_fifo()) {
+		if (fifoCount == FIFO_LEN) {					// Tryb cykliczny - najstarsza wypada
+			for (uint8_t i = 1; i < FIFO_LEN; i++)
+				for (uint8_t a = 0; a < 3; a++) fifo[i - 1][a] = fifo[i][a];
+			fifoCount--;
+			fifoOvf = 1;
+		}
+		for (uint8_t a = 0; a < 3; a++) fifo[fifoCount][a] = s[a];
+		fifoCount++;
+	}
+	mma_int();
+}
@@ -0,0 +1,172 @@
+/**
+ * @file render.c
+ * @author Maciej Kucharski
+ * @brief Renderowanie offline: przebieg sterowania z pliku tekstowego
+ *				odtwarzany na firmware w symulatorze, wynik do pliku WAV
+ *				z częstotliwością próbkowania strumienia DAC.
+ *
+ *				build/synth-render przebieg.txt wynik.wav [cisza_na_koncu_ms [evlog.bin]]
+ *
+ *				evlog.bin - zrzut rejestru zdarzeń (evlog.h) jak z debuggera,
+ *				do odczytu przez tools/evlog_decode.py.
+ *
+ *				Plik przebiegu - wiersz na zdarzenie, czas rosnący, # komentarz:
+ *				  <ms> x <oś X, 4096 = 1g>
+ *				  <ms> s1..s4 <1 - naciśnięty, 0 - zwolniony>
+ *				  <ms> slider <1-100, 0 - brak dotyku>
+ *				  <ms> i2cerr <adres> <n> - kolejne n transakcji I2C z tym adresem
+ *				                     bez ACK (np. 0x27 - LCD)
+ *				  <ms> lcd <tekst> - sprawdzenie: tekst w jednym z wierszy LCD,
+ *				                     inaczej błąd i kod wyjścia 1
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "sim.h"
+#include "klaw.h"
+#include "evlog.h"
+#include "lcd1602.h"
+
+typedef struct {
+	FILE *f;
+	uint32_t samples;
+} Wav;
+
+static void wav_u32(FILE *f, uint32_t v)
+{
+	uint8_t b[4] = { v, v >> 8, v >> 16, v >> 24 };
+	fwrite(b, 1, 4, f);
+}
+
+static void wav_u16(FILE *f, uint16_t v)
+{
+	uint8_t b[2] = { v, v >> 8 };
+	fwrite(b, 1, 2, f);
+}
+
+// Nagłówek PCM 16 bit mono, rozmiary uzupełniane w wav_close
+static void wav_header(FILE *f, uint32_t rate, uint32_t samples)
+{
+	fwrite("RIFF", 1, 4, f);
+	wav_u32(f, 36 + samples * 2);
+	fwrite("WAVEfmt ", 1, 8, f);
+	wav_u32(f, 16);
+	wav_u16(f, 1);
+	wav_u16(f, 1);
+	wav_u32(f, rate);
+	wav_u32(f, rate * 2);
+	wav_u16(f, 2);
+	wav_u16(f, 16);
+	fwrite("data", 1, 4, f);
+	wav_u32(f, samples * 2);
+}
+
+// Próbki DAC 12 bit (środek 0x800) jako 16 bit ze znakiem
+static void wav_sink(const uint16_t *samples, uint32_t count, void *ctx)
+{
+	Wav *w = ctx;
+	for (uint32_t i = 0; i < count; i++)
+		wav_u16(w->f, (uint16_t)(((int16_t)samples[i] - 0x800) * 16));
+	w->samples += count;
+}
+
+static void advance_to(uint32_t ms)
+{
+	uint64_t target = (uint64_t)ms * Sim_DacRate() / 1000;
+	if (target > simTime) Sim_Advance((uint32_t)(target - simTime));
+}
+
+int main(int argc, char **argv)
+{
+	static const uint32_t keys[4] = { S1_MASK, S2_MASK, S3_MASK, S4_MASK };
+	FILE *trace;
+	Wav wav = { 0, 0 };
+	char line[128], ev[16], *arg;
+	unsigned long ms, last = 0, line_no = 0;
+	long val;
+	int pos;
+	unsigned checks = 0, failed = 0;
+	uint32_t tail = (argc > 3) ? (uint32_t)atoi(argv[3]) : 500;
+	struct timespec t0, t1;
+	double wall;
+
+	if (argc < 3) {
+		fprintf(stderr, "uzycie: %s przebieg.txt wynik.wav [cisza_ms [evlog.bin]]\n", argv[0]);
+		return 2;
+	}
+	trace = fopen(argv[1], "r");
+	wav.f = fopen(argv[2], "wb");
+	if (!trace || !wav.f) {
+		perror(trace ? argv[2] : argv[1]);
+		return 1;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	Sim_Init();
+	wav_header(wav.f, Sim_DacRate(), 0);
+	Sim_DacSink(wav_sink, &wav);
+
+	while (fgets(line, sizeof(line), trace)) {
+		line_no++;
+		if (line[0] == '#' || sscanf(line, "%lu %15s %n", &ms, ev, &pos) != 2) continue;
+		arg = line + pos;
+		arg[strcspn(arg, "\r\n")] = 0;
+		val = strtol(arg, 0, 10);
+		if (ms < last) {
+			fprintf(stderr, "%s:%lu: czas maleje\n", argv[1], line_no);
+			return 1;
+		}
+		last = ms;
+		advance_to((uint32_t)ms);
+		if (!strcmp(ev, "x")) Sim_AccelTilt((int16_t)val);
+		else if (!strcmp(ev, "slider")) Sim_TsiTouch((uint8_t)val);
+		else if (!strcmp(ev, "i2cerr")) {
+			char *end;
+			simI2cFailAddr = (uint8_t)strtol(arg, &end, 0);
+			simI2cFail = (uint32_t)strtol(end, 0, 10);
+		}
+		else if (ev[0] == 's' && ev[1] >= '1' && ev[1] <= '4' && !ev[2]) Sim_Button(keys[ev[1] - '1'], val != 0);
+		else if (!strcmp(ev, "lcd")) {
+			char row0[LCD_COLS + 1];
+			snprintf(row0, sizeof(row0), "%s", Sim_LcdRow(0));	// Sim_LcdRow - wspólny bufor
+			checks++;
+			if (!strstr(row0, arg) && !strstr(Sim_LcdRow(1), arg)) {
+				fprintf(stderr, "%s:%lu: brak '%s' na LCD [%s] [%s]\n", argv[1], line_no, arg, row0, Sim_LcdRow(1));
+				failed++;
+			}
+		}
+		else fprintf(stderr, "%s:%lu: nieznane zdarzenie '%s'\n", argv[1], line_no, ev);
+	}
+	advance_to((uint32_t)(last + tail));
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	wall = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+
+	fseek(wav.f, 0, SEEK_SET);
+	wav_header(wav.f, Sim_DacRate(), wav.samples);
+	fclose(wav.f);
+	fclose(trace);
+	if (argc > 4) {
+#if EVLOG_ENABLE
+		FILE *f = fopen(argv[4], "wb");
+		if (!f || fwrite(&evLog, sizeof(evLog), 1, f) != 1) {
+			perror(argv[4]);
+			return 1;
+		}
+		fclose(f);
+#else
+		fprintf(stderr, "%s: rejestr zdarzen wylaczony (EVLOG_ENABLE 0)\n", argv[4]);
+		return 1;
+#endif
+	}
+
+	printf("%s: %u probek @ %u Hz (%.2f s)\n", argv[2], (unsigned)wav.samples, (unsigned)Sim_DacRate(),
+			wav.samples / (double)Sim_DacRate());
+	printf("wydajnosc: %.0f probek/s, %.0fx czas rzeczywisty\n", wav.samples / wall,
+			wav.samples / wall / Sim_DacRate());
+	if (checks)
+		printf("sprawdzenia: %u z %u zgodnych\n", checks - failed, checks);
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file sim.c
+ * @author Maciej Kucharski
+ * @brief Harmonogram symulatora - zdarzenia układów w kolejności czasu próbek.
+ */
+
+#include "sim.h"
+#include "hal.h"
+
+uint64_t simTime;
+
+static uint32_t blockPos;						// Próbki zagrane w bieżącej połowie bufora
+static uint64_t accelPhase;					// Akumulator okresu próbek czujnika [mHz * próbka]
+static uint32_t lpoPhase;						// Akumulator taktu LPO 1 kHz [Hz * próbka]
+static uint64_t tickPhase;					// Akumulator SysTick [Hz * próbka]
+
+void Sim_Init(void)
+{
+	App_Init();
+}
+
+void Sim_Advance(uint32_t samples)
+{
+	while (samples) {
+		uint32_t rate = Sim_DacRate();
+		uint32_t half = Sim_DacHalf();
+		uint32_t step;
+
+		if (!rate) {								// Strumień jeszcze nie działa - tylko pętla główna
+			App_Poll();
+			return;
+		}
+		step = half - blockPos;
+		if (step > samples) step = samples;
+
+		// Próbki czujnika przypadające na ten odcinek
+		accelPhase += (uint64_t)step * Sim_AccelOdr();
+		while (accelPhase >= (uint64_t)rate * 1000) {
+			accelPhase -= (uint64_t)rate * 1000;
+			Sim_AccelSample();
+		}
+		lpoPhase += step * 1000;
+		while (lpoPhase >= rate) {
+			lpoPhase -= rate;
+			Sim_Lptmr();
+		}
+		if ((SysTick->CTRL & (SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk)) ==
+				(SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_TICKINT_Msk)) {
+			tickPhase += (uint64_t)step * (SystemCoreClock / (SysTick->LOAD + 1));
+			while (tickPhase >= rate) {
+				tickPhase -= rate;
+				SysTick_Handler();
+			}
+		}
+
+		blockPos += step;
+		simTime += step;
+		samples -= step;
+		if (blockPos == half) {
+			blockPos = 0;
+			Sim_DacBlock();
+			Sim_TsiScan();
+			App_Poll();
+		}
+	}
+}
@@ -0,0 +1,116 @@
+/**
+ * @file sim.h
+ * @author Maciej Kucharski
+ * @brief Symulator PC: czas liczony w próbkach audio, układy zewnętrzne
+ *				(MMA8451Q, PCF8574/HD44780, slider TSI, przyciski) sterowane
+ *				z programu testowego, próbki DAC przekazywane do odbiornika.
+ */
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+
+// Urządzenie na wirtualnej magistrali I2C
+typedef struct {
+	uint8_t address;
+	void (*start)(uint8_t read);		// START / powtórzony START z adresem urządzenia
+	void (*write)(uint8_t data);
+	uint8_t (*read)(void);
+	void (*stop)(void);
+} Sim_I2cDev;
+
+extern const Sim_I2cDev simMma8451q;
+extern const Sim_I2cDev simPcf8574;
+
+// Odbiornik próbek DAC (12 bit) - wołany po każdej zagranej połowie bufora
+typedef void (*Sim_Sink)(const uint16_t *samples, uint32_t count, void *ctx);
+
+extern uint64_t simTime;					// Próbki od uruchomienia strumienia
+extern uint64_t simRenderNs;			// Łączny czas renderowania (PendSV) na PC
+extern uint32_t simRenderBlocks;
+extern uint32_t simI2cXfers;			// Transakcje i bajty na magistrali I2C
+extern uint32_t simI2cBytes;
+extern uint8_t simI2cFailAddr;			// Transakcje z tym adresem kończą się NOACK,
+extern uint32_t simI2cFail;				// tyle kolejnych (wstrzykiwanie błędów)
+extern uint32_t simLptmrTrig;			// Porównania LPTMR0 - wyzwolenia skanu TSI
+
+/**
+ * @brief App_Init() i przygotowanie symulowanych układów.
+ */
+void Sim_Init(void);
+/**
+ * @brief Przesunięcie czasu: próbki akcelerometru, połówki bufora DAC
+ *				(przerwanie DMA + PendSV) i App_Poll() po każdej połówce.
+ *
+ * @param Liczba próbek audio.
+ */
+void Sim_Advance(uint32_t samples);
+
+/**
+ * @brief Odbiornik zagranych próbek, 0 - bez przechwytywania.
+ */
+void Sim_DacSink(Sim_Sink sink, void *ctx);
+/**
+ * @brief Częstotliwość próbkowania strumienia DAC (0 przed Audio_Init).
+ */
+uint32_t Sim_DacRate(void);
+/**
+ * @brief Próbek w połowie bufora DAC.
+ */
+uint32_t Sim_DacHalf(void);
+/**
+ * @brief Koniec połowy bufora: odbiornik, przerwanie DMA, PendSV.
+ *				Bez DMA (DAC_Clock_Start) - blok przerwań TPM0 po jednej próbce.
+ */
+void Sim_DacBlock(void);
+
+/**
+ * @brief Przechylenie płytki - wartość osi X kolejnych próbek (4096 = 1g).
+ */
+void Sim_AccelTilt(int16_t x);
+/**
+ * @brief Częstotliwość próbek czujnika [mHz], 0 w trybie standby.
+ */
+uint32_t Sim_AccelOdr(void);
+/**
+ * @brief Jedna próbka czujnika: FIFO/rejestry wyjściowe i linia INT2 (PTA10).
+ */
+void Sim_AccelSample(void);
+
+/**
+ * @brief Tekst wiersza wyświetlacza (16 znaków).
+ */
+const char *Sim_LcdRow(uint8_t row);
+
+/**
+ * @brief Dotyk slidera.
+ *
+ * @param Pozycja 1-100, 0 - brak dotyku.
+ */
+void Sim_TsiTouch(uint8_t value);
+/**
+ * @brief Koniec skanu elektrod - zmiana pozycji jako zdarzenie, jak z TSI0_IRQHandler.
+ */
+void Sim_TsiScan(void);
+
+/**
+ * @brief Naciśnięcie (stan niski + PORTB_IRQHandler) lub zwolnienie przycisku.
+ *
+ * @param Maska S1_MASK..S4_MASK.
+ * @param 1 - naciśnięty.
+ */
+void Sim_Button(uint32_t mask, uint8_t pressed);
+
+/**
+ * @brief Takt LPO 1 kHz dla LPTMR0 - licznik, porównanie z CMR, TCF
+ *				(licznik stoi do skasowania, TFC = 0), wyzwolenie TSI i przerwanie.
+ */
+void Sim_Lptmr(void);
+
+/**
+ * @brief Zbocze na pinie PTA/PTB - ustawienie ISFR według IRQC i wywołanie przerwania.
+ */
+void Sim_Pin(uint8_t port, uint8_t pin, uint8_t level);
+
+#endif /* SIM_H */
@@ -0,0 +1,38 @@
+/**
+ * @file tsi.c
+ * @author Maciej Kucharski
+ * @brief tsi.h dla symulatora - pozycja slidera ustawiana przez Sim_TsiTouch,
+ *				zmiana zgłaszana (EVENT_TSI) po skanie co połowę bufora DAC, jeśli
+ *				LPTMR0 wyzwolił skan od poprzedniego (jak STM w tsi.c).
+ */
+
+#include "tsi.h"
+#include "sim.h"
+#include "event.h"
+
+static uint8_t touch;
+static uint8_t position;				// Pozycja po ostatnim skanie - jak w tsi.c
+static uint32_t trig;						// simLptmrTrig przy ostatnim skanie
+
+void TSI_Init(void)
+{
+}
+
+uint8_t TSI_ReadSlider(void)
+{
+	return position;
+}
+
+void Sim_TsiScan(void)
+{
+	if (trig == simLptmrTrig) return;	// Bez wyzwolenia sprzętowego nie ma skanu
+	trig = simLptmrTrig;
+	if (position == touch) return;
+	position = touch;
+	Event_Post(EVENT_TSI, position);
+}
+
+void Sim_TsiTouch(uint8_t value)
+{
+	touch = value > 100 ? 100 : value;
+}
@@ -0,0 +1,114 @@
+#include "synth.h"
+#include "voice.h"
+#include "env.h"
+#include "audio.h"
+#include "glide.h"
+#include "dds.h"
+
+#define SYNTH_LEGATO_KEY	0xFE						// Klawisz głosu prowadzonego przez portamento
+
+static volatile uint8_t waveForm;						// Kształt fali (0-sinus, 1-trojkat, 2-pila)
+static volatile int32_t gainTarget;				// Wzmocnienie wyjścia Q15 z głośności (Synth_SetVolume)
+static int32_t gain;												// Wzmocnienie na końcu ostatniego bloku (Q15)
+static int32_t mix[AUDIO_BLOCK];						// Akumulator miksera (suma głosów Q15)
+static uint8_t leadKey = VOICE_NONE;				// Klawisz grającej nuty (bez portamento)
+static volatile uint8_t leadVoice = VOICE_NONE;	// Głos prowadzony przez portamento
+
+void Synth_Init(void)
+{
+	for (uint8_t v = 0; v < VOICE_COUNT; v++)
+	{
+		voices.envStage[v] = ENV_IDLE;
+		voices.envLevel[v] = 0;
+		voices.envStep[v] = 0;
+		voices.key[v] = VOICE_NONE;
+	}
+}
+
+void Synth_NoteOn(uint8_t key, uint32_t tw)
+{
+	Voice_NoteOn(key, tw, waveForm, SYNTH_VOICE_GAIN);
+}
+
+void Synth_NoteOff(uint8_t key)
+{
+	Voice_NoteOff(key);
+}
+
+void Synth_SetPitch(uint16_t pitch)
+{
+	if (Glide_Mode() == GLIDE_OFF)
+	{
+		// Nowy półton dopiero po wyjściu poza bieżący o pół półtonu i histerezę
+		int32_t d = (int32_t)pitch - ((int32_t)leadKey << 8);
+		uint8_t key = (uint8_t)((pitch + 128) >> 8);
+		if ((leadKey == VOICE_NONE) || (d > 128 + GLIDE_HYST) || (d < -(128 + GLIDE_HYST)))
+		{
+			Voice_NoteOff(leadKey);
+			Voice_NoteOn(key, DDS_PitchWord((uint16_t)key << 8), waveForm, SYNTH_VOICE_GAIN);
+			leadKey = key;
+		}
+	}
+	else
+	{
+		Glide_SetTarget(pitch);
+		if (leadVoice == VOICE_NONE)
+		{
+			Glide_Jump(pitch);
+			leadVoice = Voice_NoteOn(SYNTH_LEGATO_KEY, DDS_PitchWord(pitch), waveForm, SYNTH_VOICE_GAIN);
+		}
+	}
+}
+
+void Synth_SetGlide(uint8_t mode)
+{
+	if (mode == Glide_Mode()) return;
+	leadVoice = VOICE_NONE;
+	Voice_NoteOff(SYNTH_LEGATO_KEY);
+	Voice_NoteOff(leadKey);
+	leadKey = VOICE_NONE;
+	Glide_SetMode(mode);	// Następne Synth_SetPitch zaczyna nową nutę
+}
+
+void Synth_SetGlideTime(uint16_t ms)
+{
+	Glide_SetTime(ms);
+}
+
+void Synth_SetWave(uint8_t form)
+{
+	waveForm = form;
+	Voice_SetForm(form);
+}
+
+void Synth_SetVolume(uint8_t vol)
+{
+	if (vol > 100) vol = 100;
+	gainTarget = ((int32_t)vol * SYNTH_GAIN_ONE + 50) / 100;	// Dzielenie raz na zmianę, nie na próbkę
+}
+
+void Synth_Render(uint16_t *out, uint32_t count)
+{
+	int32_t target = gainTarget;	// Parametry odczytywane raz na blok
+	int32_t g = gain;
+	int32_t step = (target - g) >> AUDIO_BLOCK_SHIFT;	// Rampa liniowa do nowej głośności w jednym bloku
+
+	for (uint32_t i = 0; i < count; i++)
+		mix[i] = 0;
+	uint8_t lead = leadVoice;
+	if (lead != VOICE_NONE)
+		Voice_SetPitch(lead, DDS_PitchWord(Glide_Tick()));	// Portamento z częstotliwością bloków
+	Env_Tick();
+	Voice_Mix(mix, count);
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		// Suma Q15 -> 12 bit, dodane 0x0800 czyli 2048 aby uzyskac dodatnie wyniki dla dac
+		int32_t sample = (((mix[i] >> 4) * g) >> 15) + 0x0800;
+		g += step;
+		if (sample < 0) sample = 0;						// Nasycenie przy sumie kilku głosów
+		if (sample > 0x0FFF) sample = 0x0FFF;
+		out[i] = (uint16_t)sample;
+	}
+	gain = target;	// Reszta z przesunięcia (< 2^AUDIO_BLOCK_SHIFT) bez znaczenia
+}
@@ -0,0 +1,73 @@
+/**
+ * @file synth.h
+ * @author Maciej Kucharski
+ * @brief Silnik syntezy - generowanie bloków próbek dla DAC z puli głosów.
+ */
+
+#ifndef SYNTH_H
+#define SYNTH_H
+
+#include "main.h"
+
+/**
+ * @brief Inicjalizacja puli głosów (wszystkie wolne).
+ */
+void Synth_Init(void);
+/**
+ * @brief Włączenie nuty.
+ *
+ * @param Klawisz (półton względem C najniższej oktawy).
+ * @param Słowo strojenia DDS (DDS_TuningWord).
+ */
+void Synth_NoteOn(uint8_t key, uint32_t tuningWord);
+/**
+ * @brief Wyłączenie nuty.
+ *
+ * @param Klawisz (półton).
+ */
+void Synth_NoteOff(uint8_t key);
+/**
+ * @brief Wysokość prowadzonej nuty (sterowanie akcelerometrem). Bez portamento
+ *				każdy nowy półton to nowa nuta z obwiednią, z portamento jeden głos
+ *				legato płynie do nowej wysokości.
+ *
+ * @param Wysokość (półtony Q8 względem C najniższej oktawy).
+ */
+void Synth_SetPitch(uint16_t pitch);
+/**
+ * @brief Tryb portamento.
+ *
+ * @param GLIDE_OFF, GLIDE_QUANT lub GLIDE_CONT.
+ */
+void Synth_SetGlide(uint8_t mode);
+/**
+ * @brief Czas portamento w trybie GLIDE_CONT.
+ *
+ * @param Czas przejścia o oktawę [ms].
+ */
+void Synth_SetGlideTime(uint16_t ms);
+/**
+ * @brief Ustawienie kształtu fali (nowe i grające nuty).
+ *
+ * @param Kształt fali (0-sinus, 1-trojkat, 2-pila).
+ */
+void Synth_SetWave(uint8_t form);
+/**
+ * @brief Ustawienie głośności.
+ *
+ * @param Głośność (0-100).
+ */
+void Synth_SetVolume(uint8_t volume);
+/**
+ * @brief Generowanie bloku próbek (wywoływane z kontekstu renderowania).
+ *				Raz na blok krok portamento i obwiedni, potem mikser głosów.
+ *
+ * @param Bufor na próbki 12-bitowe dla DAC.
+ * @param Liczba próbek (AUDIO_BLOCK - krok obwiedni jest liczony na blok).
+ */
+void Synth_Render(uint16_t *out, uint32_t count);
+
+#define SYNTH_VOICE_GAIN	0x7FFF					// Wzmocnienie głosu Q15
+#define SYNTH_GAIN_ONE		(1L << 15)			// Wzmocnienie wyjścia 1.0 (Q15), głośność 100
+
+#endif /* SYNTH_H */
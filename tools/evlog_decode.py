@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Dekoder rejestru zdarzen sterowania (evlog.h).
+
+Czyta zrzut zmiennej evLog: binarny (np. z build/synth-render) albo
+Intel HEX z debuggera Keil, np. w oknie Command:
+
+    SAVE evlog.hex &evLog, &evLog + sizeof(evLog) - 1
+
+Wypisuje zdarzenia od najstarszego, czas w ms od pierwszego zdarzenia.
+Z opcja --trace wynik jest przebiegiem dla build/synth-render, wiec
+nagranie z plytki mozna odtworzyc i odsluchac na PC:
+
+    python3 tools/evlog_decode.py evlog.hex
+    python3 tools/evlog_decode.py --trace evlog.hex > nagranie.trace
+"""
+
+import struct
+import sys
+
+MAGIC = 0x314C5645
+HEADER = struct.Struct('<IIIBBBBBB2x')
+EV_END, EV_ACCEL, EV_KEY, EV_SLIDER = range(4)
+EV_DT = 31
+KEY_HOLD_MS = 50  # Czas naciskania przycisku w przebiegu (rejestr ma tylko naciskniecia)
+
+
+def read_dump(path):
+    """Bajty zrzutu, Intel HEX rozpoznawany po ':' na poczatku."""
+    with open(path, 'rb') as f:
+        raw = f.read()
+    if not raw.lstrip().startswith(b':'):
+        return raw
+    mem = {}
+    base = 0
+    for line in raw.decode('ascii').split():
+        rec = bytes.fromhex(line[1:])
+        count, addr, kind = rec[0], (rec[1] << 8) | rec[2], rec[3]
+        data = rec[4:4 + count]
+        if kind == 0:
+            for i, b in enumerate(data):
+                mem[base + addr + i] = b
+        elif kind == 2:
+            base = ((data[0] << 8) | data[1]) << 4
+        elif kind == 4:
+            base = ((data[0] << 8) | data[1]) << 16
+        elif kind == 1:
+            break
+    start = min(mem)
+    return bytes(mem.get(a, 0) for a in range(start, max(mem) + 1))
+
+
+def varint(buf, pos):
+    value = shift = 0
+    while True:
+        b = buf[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return value, pos
+
+
+def chunk_events(chunk, end):
+    """Zdarzenia jednego bloku: (takt, typ, wartosc)."""
+    t = struct.unpack_from('<I', chunk)[0]
+    accel = 0
+    pos = 4
+    while pos < end:
+        head = chunk[pos]
+        pos += 1
+        kind, dt = head >> 5, head & 0x1F
+        if kind == EV_END:
+            break
+        if dt == EV_DT:
+            extra, pos = varint(chunk, pos)
+            dt += extra
+        t = (t + dt) & 0xFFFFFFFF
+        if kind == EV_ACCEL:
+            z, pos = varint(chunk, pos)
+            accel = (accel + ((z >> 1) ^ -(z & 1)) + 0x8000) % 0x10000 - 0x8000
+            value = accel
+        else:
+            value = chunk[pos]
+            pos += 1
+        yield t, kind, value
+
+
+def decode(dump):
+    magic, rate, events, tick_shift, size, chunks, head, pos, filled = HEADER.unpack_from(dump)
+    if magic != MAGIC:
+        sys.exit('to nie jest zrzut evLog (magic %08x)' % magic)
+    data = dump[HEADER.size:HEADER.size + size * chunks]
+    if filled < chunks:
+        order = range(filled)
+    else:
+        order = [(head + 1 + i) % chunks for i in range(chunks)]
+    out = []
+    for c in order:
+        chunk = data[c * size:(c + 1) * size]
+        out.extend(chunk_events(chunk, pos if c == head else size))
+    return rate, tick_shift, events, out
+
+
+def main(argv):
+    trace = '--trace' in argv
+    args = [a for a in argv if a != '--trace']
+    if len(args) != 1:
+        sys.exit(__doc__)
+    rate, tick_shift, total, events = decode(read_dump(args[0]))
+    if not events:
+        return
+    ms_per_tick = 1000.0 * (1 << tick_shift) / rate
+    t0 = events[0][0]
+    lines = []
+    for t, kind, value in events:
+        ms = round(((t - t0) & 0xFFFFFFFF) * ms_per_tick)
+        if kind == EV_ACCEL:
+            lines.append((ms, 'x', value))
+        elif kind == EV_KEY:
+            lines.append((ms, 's%d' % value, 1))
+            if trace:
+                lines.append((ms + KEY_HOLD_MS, 's%d' % value, 0))
+        else:
+            lines.append((ms, 'slider', value))
+    lines.sort(key=lambda l: l[0])
+    print('# evLog: %d z %d zdarzen, %d Hz, takt %.2f ms'
+          % (len(events), total, rate, ms_per_tick))
+    for ms, name, value in lines:
+        print('%d %s %d' % (ms, name, value))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+"""Generator tablic przyciagania do skali dla scale.c.
+
+Tworzy scales.c z tablicami SCALE_STEPS bajtow na skale. Indeks to wysokosc
+(poltony Q8 od toniki) przesunieta o SCALE_STEP_SHIFT, czyli krok 1/4 poltonu
+przez SCALE_RANGE_MAX oktaw, wartosc to najblizszy stopien skali (polton od
+toniki). Skala wlasna (SCALE_USER) to USER ponizej - po zmianie wygenerowac
+plik ponownie. Uruchomienie z katalogu projektu:
+
+    python3 tools/gen_scales.py [scales.c]
+"""
+
+import sys
+
+RANGE_MAX = 3        # SCALE_RANGE_MAX
+STEP_SHIFT = 6       # SCALE_STEP_SHIFT
+STEPS_PER_SEMI = 1 << (8 - STEP_SHIFT)
+STEPS = RANGE_MAX * 12 * STEPS_PER_SEMI + 1
+
+# Poltony od toniki w oktawie
+USER = (0, 2, 3, 5, 7, 8, 11)  # Skala wlasna: molowa harmoniczna
+
+SCALES = (
+    ("scaleMajor", "Durowa", (0, 2, 4, 5, 7, 9, 11)),
+    ("scaleMinor", "Molowa naturalna", (0, 2, 3, 5, 7, 8, 10)),
+    ("scalePentatonic", "Pentatonika durowa", (0, 2, 4, 7, 9)),
+    ("scaleBlues", "Bluesowa", (0, 3, 5, 6, 7, 10)),
+    ("scaleUser", "Wlasna (USER)", USER),
+)
+
+
+def snap_table(degrees):
+    tones = [o * 12 + d for o in range(RANGE_MAX) for d in degrees] + [RANGE_MAX * 12]
+    table = []
+    for i in range(STEPS):
+        # Srodek kroku, przy rownej odleglosci nizszy stopien
+        pos = (i + 0.5) / STEPS_PER_SEMI
+        table.append(min(tones, key=lambda t: (abs(t - pos), t)))
+    return table
+
+
+def emit(out, name, comment, degrees):
+    values = snap_table(degrees)
+    out.write("// %s: %s\n" % (comment, " ".join(str(d) for d in degrees)))
+    out.write("const uint8_t %s[SCALE_STEPS] = {\n" % name)
+    for i in range(0, len(values), 24):
+        row = ", ".join("%2d" % v for v in values[i:i + 24])
+        out.write("\t%s%s\n" % (row, "," if i + 24 < len(values) else ""))
+    out.write("};\n")
+
+
+def main(out):
+    out.write("/* Plik generowany przez tools/gen_scales.py - nie edytowac recznie. */\n\n")
+    out.write('#include "scale.h"\n\n')
+    for i, (name, comment, degrees) in enumerate(SCALES):
+        if i:
+            out.write("\n")
+        emit(out, name, comment, degrees)
+
+
+if __name__ == "__main__":
+    path = sys.argv[1] if len(sys.argv) > 1 else "scales.c"
+    with open(path, "w", newline="\r\n") as f:  # CRLF jak reszta zrodel
+        main(f)
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""Generator tablic falowych dla wavetable.c.
+
+Tworzy wavetables.c z tablicami 16-bitowymi (Q15) o dlugosci WAVE_LEN + 1
+(ostatnia probka powtarza pierwsza, zeby interpolacja nie musiala zawijac
+indeksu). Trojkat i pila sa generowane jako zestawy pasmowo ograniczone:
+jedna tablica na oktawe slowa strojenia (WAVE_BANDS), z szeregiem Fouriera
+obcietym ponizej czestotliwosci Nyquista dla najwyzszego slowa w pasmie.
+Uruchomienie z katalogu projektu:
+
+    python3 tools/gen_wavetables.py [wavetables.c]
+"""
+
+import math
+import sys
+
+WAVE_BITS = 8
+WAVE_LEN = 1 << WAVE_BITS
+WAVE_BANDS = 8
+AMPLITUDE = 32767
+
+
+def band_harmonics(band):
+    """Najwyzsza harmoniczna dla pasma.
+
+    Pasmo 0: slowo strojenia < 2^24, pasmo k >= 1: slowo < 2^(24 + k).
+    Harmoniczna n jest ponizej Nyquista, gdy n * slowo < 2^31. Tablica 256
+    punktow przenosi najwyzej 127 harmonicznych.
+    """
+    if band == 0:
+        return WAVE_LEN // 2 - 1
+    return 1 << (7 - band)
+
+
+def sine(t, harmonics):
+    return math.sin(2.0 * math.pi * t)
+
+
+def triangle(t, harmonics):
+    # Tylko nieparzyste harmoniczne, amplituda 1/n^2
+    s = 0.0
+    for n in range(1, harmonics + 1, 2):
+        sign = 1.0 if (n // 2) % 2 == 0 else -1.0
+        s += sign * math.sin(2.0 * math.pi * n * t) / (n * n)
+    return s
+
+
+def saw(t, harmonics):
+    # Narasta od 0 do szczytu w polowie okresu, potem skok na -szczyt (jak Pila[])
+    s = 0.0
+    for n in range(1, harmonics + 1):
+        sign = 1.0 if n % 2 == 1 else -1.0
+        s += sign * math.sin(2.0 * math.pi * n * t) / n
+    return s
+
+
+def table(fn, harmonics):
+    raw = [fn(i / WAVE_LEN, harmonics) for i in range(WAVE_LEN)]
+    peak = max(abs(v) for v in raw)
+    values = [int(round(AMPLITUDE * v / peak)) for v in raw]
+    return values + values[:1]
+
+
+def emit_rows(out, values, indent):
+    for i in range(0, len(values), 12):
+        row = ", ".join("%6d" % v for v in values[i:i + 12])
+        out.write("%s%s%s\n" % (indent, row, "," if i + 12 < len(values) else ""))
+
+
+def emit(out, name, comment, fn):
+    out.write("// %s\n" % comment)
+    out.write("const int16_t %s[WAVE_LEN + 1] = {\n" % name)
+    emit_rows(out, table(fn, 1), "\t")
+    out.write("};\n\n")
+
+
+def emit_bands(out, name, comment, fn):
+    out.write("// %s - tablice pasmowo ograniczone, pasmo = waveBand[slowo >> 24]\n" % comment)
+    out.write("const int16_t %s[WAVE_BANDS][WAVE_LEN + 1] = {\n" % name)
+    for band in range(WAVE_BANDS):
+        out.write("\t{\t// pasmo %d: do %d harmonicznej\n" % (band, band_harmonics(band)))
+        emit_rows(out, table(fn, band_harmonics(band)), "\t\t")
+        out.write("\t}%s\n" % ("," if band + 1 < WAVE_BANDS else ""))
+    out.write("};\n\n")
+
+
+def emit_band_lut(out):
+    # Pasmo = liczba bitow (slowo >> 24), ograniczona do WAVE_BANDS - 1
+    lut = [min(v.bit_length(), WAVE_BANDS - 1) for v in range(256)]
+    out.write("// Numer pasma dla 8 najstarszych bitow slowa strojenia\n")
+    out.write("const uint8_t waveBand[256] = {\n")
+    for i in range(0, 256, 32):
+        out.write("\t%s%s\n" % (", ".join(str(v) for v in lut[i:i + 32]), "," if i + 32 < 256 else ""))
+    out.write("};\n")
+
+
+def main(out):
+    out.write("/* Plik generowany przez tools/gen_wavetables.py - nie edytowac recznie. */\n\n")
+    out.write('#include "wavetable.h"\n\n')
+    emit(out, "waveSine", "Sinus", sine)
+    emit_bands(out, "waveTriangle", "Trojkat", triangle)
+    emit_bands(out, "waveSaw", "Pila", saw)
+    emit_band_lut(out)
+
+
+if __name__ == "__main__":
+    path = sys.argv[1] if len(sys.argv) > 1 else "wavetables.c"
+    with open(path, "w", newline="\r\n") as f:  # CRLF jak reszta zrodel
+        main(f)
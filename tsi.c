@@ -7,10 +7,19 @@
  * @author Sebastian Koryciak & Mariusz Sokoowski
  * @date Wrzesie 2024
  * @brief File containing definitions.
- * @ver 0.2
+ * @ver 0.3
+ *
+ * Scans are started by the LPTMR hardware trigger (1 kHz, klaw.c), one
+ * electrode per trigger. LPTMR0_IRQHandler clears TCF on every tick - with
+ * TFC = 0 the counter stays at zero while TCF is set and scans would stop.
+ * Counts are IIR filtered per electrode, baseline follows slow drift while
+ * the slider is not touched and the position is cached, so TSI_ReadSlider
+ * costs nothing.
  */
 
 #include "tsi.h"
+#include "prof.h"
+#include "event.h"
 
 /******************************************************************************\
 * Private definitions
@@ -21,24 +30,28 @@
 #define ELECTRODE1   			8
 #define TOUCH0						13	/* PTA13 */
 #define TOUCH1						12	/* PTA12 */
-#define THRESHOLD0   			100
-#define THRESHOLD1   			100
+#define THRESHOLD_ON			100	/* touch when sum of deltas goes above */
+#define THRESHOLD_OFF			60	/* release when sum of deltas goes below */
+#define IIR_SHIFT					2		/* count filter: 1/4 of new scan (~8 ms at 500 Hz per electrode) */
+#define BASE_SHIFT				9		/* baseline: 1/512 of filtered count (~1 s), only without touch */
+#define FRAC							4		/* fractional bits of filtered counts and baseline */
 /******************************************************************************\
 * Private prototypes
 \******************************************************************************/
 void change_electrode(void);
+void update_position(void);
 void self_calibration(void);
 void TSI0_IRQHandler(void);
 /******************************************************************************\
 * Private memory declarations
 \******************************************************************************/
 static uint8_t elec_array[TOTAL_ELECTRODE]={ELECTRODE0,ELECTRODE1};
-static uint16_t gu16TSICount[TOTAL_ELECTRODE];
-static uint16_t gu16Baseline[TOTAL_ELECTRODE];
-static uint16_t gu16Threshold[TOTAL_ELECTRODE]={THRESHOLD0,THRESHOLD1};
+static uint32_t gu32Filtered[TOTAL_ELECTRODE];	/* counts << FRAC */
+static uint32_t gu32Baseline[TOTAL_ELECTRODE];	/* counts << FRAC */
 static uint16_t gu16Delta[TOTAL_ELECTRODE];
 static uint8_t ongoing_elec=0;
-static uint8_t end_flag = FALSE;
+static uint8_t touched = FALSE;
+static volatile uint8_t position = 0;	/* 1-100, 0 = not touched */
 
 void TSI_Init (void) {
   SIM->SCGC5 |= SIM_SCGC5_TSI_MASK;  /* Enable clock gating for TSI */
@@ -55,6 +68,7 @@ void TSI_Init (void) {
                 | TSI_GENCS_NSCN(29)
                 | TSI_GENCS_TSIIEN_MASK 
                 | TSI_GENCS_STPE_MASK
+                | TSI_GENCS_STM_MASK    /* hardware trigger (LPTMR) */
 								| TSI_GENCS_TSIEN_MASK);
 	
 	NVIC_SetPriority(TSI0_IRQn, 3);
@@ -64,29 +78,7 @@ void TSI_Init (void) {
 }
 
 uint8_t TSI_ReadSlider (void) {
-
-  int a = 0;
-  int b = 0;
-
-	if(end_flag)
-	{
-		if((gu16Delta[0]>gu16Threshold[0])||(gu16Delta[1]>gu16Threshold[1]))
-		{
-		  a = (gu16Delta[0]*100)/(gu16Delta[0]+gu16Delta[1]);
-		  b = (gu16Delta[1]*100)/(gu16Delta[0]+gu16Delta[1]);
-			end_flag = FALSE;
-		  return (uint8_t)((100 - a + b)/2);
-		}
-		else
-		{
-			end_flag = FALSE;
-			return 0;
-		}
-	}
-	else
-	{
-		return 0;
-	}
+	return position;
 }
 /**
  * @brief Calibration for initialization purpose.
@@ -112,7 +104,8 @@ void self_calibration(void) {
     TSI0->DATA |= TSI_DATA_SWTS_MASK;
     while(!(TSI0->GENCS & TSI_GENCS_EOSF_MASK));
     TSI0->GENCS |= TSI_GENCS_EOSF_MASK;
-    gu16Baseline[cnt] = (TSI0->DATA & TSI_DATA_TSICNT_MASK); 
+    gu32Baseline[cnt] = (TSI0->DATA & TSI_DATA_TSICNT_MASK) << FRAC; 
+    gu32Filtered[cnt] = gu32Baseline[cnt];
   }
   
   TSI0->GENCS &= ~TSI_GENCS_TSIEN_MASK;    /* Disable TSI module */
@@ -121,44 +114,63 @@ void self_calibration(void) {
   else TSI0->GENCS &= ~TSI_GENCS_STM_MASK;
   
   TSI0->GENCS |= TSI_GENCS_TSIEN_MASK;     /* Enable TSI module */
-  TSI0->DATA = (uint32_t)((elec_array[0]<<TSI_DATA_TSICH_SHIFT));
-  TSI0->DATA |= TSI_DATA_SWTS_MASK;
+  TSI0->DATA = (uint32_t)((elec_array[0]<<TSI_DATA_TSICH_SHIFT));	/* first channel for the trigger */
 }
 /**
- * @brief Change electrode routine.
+ * @brief Slider position from both deltas, with touch/release hysteresis.
+ */
+void update_position(void)
+{
+	uint32_t sum = (uint32_t)gu16Delta[0] + gu16Delta[1];
+	uint8_t pos;
+	
+	if (touched) touched = (sum >= THRESHOLD_OFF);
+	else touched = (sum > THRESHOLD_ON);
+	if (touched) {
+		int a = (gu16Delta[0]*100)/sum;
+		int b = (gu16Delta[1]*100)/sum;
+		pos = (uint8_t)((100 - a + b)/2);
+		if (pos == 0) pos = 1;
+	}
+	else pos = 0;
+	if (pos != position) {
+		position = pos;
+		Event_Post(EVENT_TSI, pos);
+	}
+}
+/**
+ * @brief Change electrode routine: filter and baseline for the scanned electrode.
  */
 void change_electrode(void)
 {
-  int16_t s16temp_delta;
-	if(!end_flag)
-  {
-		gu16TSICount[ongoing_elec] = (TSI0->DATA & TSI_DATA_TSICNT_MASK);		/* Save Counts for current electrode */		
-		s16temp_delta =  (int16_t)(gu16TSICount[ongoing_elec] - gu16Baseline[ongoing_elec]);		/* Obtains Counts Delta from callibration reference */  
-		if( s16temp_delta < 0)
-			gu16Delta[ongoing_elec] = 0;
-		else
-			gu16Delta[ongoing_elec] = (uint16_t)s16temp_delta;    
-		if(TOTAL_ELECTRODE > 1)
-		{  //Change Electrode to Scan
-			if((TOTAL_ELECTRODE-1) > ongoing_elec)
-				ongoing_elec++;
-			else
-			{
-				ongoing_elec = 0;
-				end_flag = TRUE;
-			}
-			TSI0->DATA = (uint32_t)((elec_array[ongoing_elec]<<TSI_DATA_TSICH_SHIFT));
-		}		
+	uint32_t count = (TSI0->DATA & TSI_DATA_TSICNT_MASK) << FRAC;
+	uint32_t *f = &gu32Filtered[ongoing_elec];
+	uint32_t *base = &gu32Baseline[ongoing_elec];
+	
+	*f = *f - (*f >> IIR_SHIFT) + (count >> IIR_SHIFT);	/* IIR low-pass */
+	if (*f < *base) *base = *f;													/* follow drops at once */
+	else if (!touched) *base += (*f - *base) >> BASE_SHIFT;	/* slow drift */
+	gu16Delta[ongoing_elec] = (uint16_t)((*f - *base) >> FRAC);
+	
+	if((TOTAL_ELECTRODE-1) > ongoing_elec)
+		ongoing_elec++;
+	else
+	{
+		ongoing_elec = 0;
+		update_position();
 	}
-	TSI0->DATA |= TSI_DATA_SWTS_MASK; 
+	TSI0->DATA = (uint32_t)((elec_array[ongoing_elec]<<TSI_DATA_TSICH_SHIFT));	/* channel for next trigger */
 }
 /**
  * @brief Interrupt handler for Touch Slider.
  */
 void TSI0_IRQHandler(void)
 {
+	uint16_t t0 = Prof_Now();
+	
 	TSI0->GENCS |= TSI_GENCS_EOSF_MASK; /* Clear End of Scan Flag */
 	change_electrode();
+	Prof_End(PROF_TSI, t0);
 } 
 
 
@@ -17,11 +17,13 @@
 
 
 /**
- * @brief Touch slider initialization.
+ * @brief Touch slider initialization. Scans are triggered by LPTMR,
+ *        which must already run (Klaw_Tick_Init).
  */
 void TSI_Init(void);
 /**
- * @brief Return value read from the slider (0,100).
+ * @brief Return cached slider position (1-100, 0 = not touched).
+ *        Every change is also posted as EVENT_TSI (event.h).
  */
 uint8_t TSI_ReadSlider (void);
 
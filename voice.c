@@ -0,0 +1,90 @@
+#include "voice.h"
+#include "wavetable.h"
+#include "env.h"
+
+VoicePool voices;
+static uint16_t voiceAge = 0;		// Licznik przydziałów
+
+/**
+ * @brief Wybór głosu: wolny, a gdy brak - najcichszy, przy remisie najstarszy.
+ */
+static uint8_t voice_alloc(void)
+{
+	uint8_t best = 0;
+	for (uint8_t v = 0; v < VOICE_COUNT; v++)
+	{
+		if (voices.envStage[v] == ENV_IDLE)
+			return v;
+		if ((voices.envLevel[v] < voices.envLevel[best]) ||
+				((voices.envLevel[v] == voices.envLevel[best]) && ((int16_t)(voices.age[v] - voices.age[best]) < 0)))
+			best = v;
+	}
+	return best;
+}
+
+uint8_t Voice_NoteOn(uint8_t key, uint32_t tw, uint8_t form, int16_t gain)
+{
+	__disable_irq();			// Bez renderowania (PendSV) w trakcie zmiany głosu
+	uint8_t v = voice_alloc();
+	if (voices.envStage[v] == ENV_IDLE)
+		voices.phase[v] = 0;	// Skradziony głos zachowuje fazę i poziom - bez trzasku
+	voices.tuningWord[v] = tw;
+	voices.form[v] = form;
+	voices.table[v] = Wave_Select(form, tw);
+	voices.gain[v] = gain;
+	voices.key[v] = key;
+	voices.age[v] = voiceAge++;
+	Env_Start(v);
+	__enable_irq();
+	return v;
+}
+
+void Voice_NoteOff(uint8_t key)
+{
+	if (key == VOICE_NONE) return;
+	for (uint8_t v = 0; v < VOICE_COUNT; v++)
+	{
+		if (voices.key[v] == key)
+		{
+			Env_Release(v);
+			voices.key[v] = VOICE_NONE;
+		}
+	}
+}
+
+void Voice_SetPitch(uint8_t v, uint32_t tw)
+{
+	voices.tuningWord[v] = tw;
+	voices.table[v] = Wave_Select(voices.form[v], tw);	// Tablica bez aliasingu dla nowej wysokości
+}
+
+void Voice_SetForm(uint8_t form)
+{
+	for (uint8_t v = 0; v < VOICE_COUNT; v++)
+	{
+		voices.form[v] = form;
+		voices.table[v] = Wave_Select(form, voices.tuningWord[v]);
+	}
+}
+
+void Voice_Mix(int32_t *mix, uint32_t count)
+{
+	for (uint8_t v = 0; v < VOICE_COUNT; v++)
+	{
+		int32_t level = voices.envLevel[v];
+		int32_t step = voices.envStep[v];
+		if ((level | step) == 0) continue;	// Głos wyciszony
+
+		uint32_t ph = voices.phase[v];
+		uint32_t tw = voices.tuningWord[v];
+		const int16_t *table = voices.table[v];
+		int32_t *acc = mix;
+		for (uint32_t i = count; i; i--)
+		{
+			*acc++ += (Wave_Interp(table, ph) * (level >> 15)) >> 15;	// Próbka Q15 * poziom Q15
+			level += step;
+			ph += tw;
+		}
+		voices.phase[v] = ph;
+	}
+}
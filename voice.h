@@ -0,0 +1,73 @@
+/**
+ * @file voice.h
+ * @author Maciej Kucharski
+ * @brief Pula głosów syntezatora - przydział, kradzież głosów i mikser z obwiednią.
+ *				Stan głosów w układzie struktury tablic (SoA), żeby pętla miksera
+ *				ładowała tylko potrzebne pola.
+ */
+
+#ifndef VOICE_H
+#define VOICE_H
+
+#include "main.h"
+
+#define VOICE_COUNT		4									// Liczba głosów
+#define VOICE_NONE		0xFF							// Brak głosu / klawisza
+
+typedef struct {
+	uint32_t phase[VOICE_COUNT];					// Akumulator fazy DDS
+	uint32_t tuningWord[VOICE_COUNT];			// Przyrost fazy na próbkę
+	const int16_t *table[VOICE_COUNT];		// Tablica fali (kształt i pasmo)
+	int16_t gain[VOICE_COUNT];						// Wzmocnienie Q15 (szczyt obwiedni)
+	int32_t envLevel[VOICE_COUNT];				// Poziom obwiedni na początku bloku (Q30)
+	int32_t envStep[VOICE_COUNT];					// Przyrost poziomu na próbkę
+	uint8_t envStage[VOICE_COUNT];				// Faza obwiedni (ENV_IDLE - głos wolny)
+	uint8_t form[VOICE_COUNT];						// Kształt fali (0-sinus, 1-trojkat, 2-pila)
+	uint8_t key[VOICE_COUNT];							// Klawisz (półton), VOICE_NONE - zwolniony
+	uint16_t age[VOICE_COUNT];						// Numer przydziału - mniejszy = starszy
+} VoicePool;
+
+extern VoicePool voices;
+
+/**
+ * @brief Przydział głosu dla klawisza i start obwiedni. Gdy brak wolnego -
+ *				kradzież najcichszego, przy równej głośności najstarszego.
+ *
+ * @param Klawisz (półton).
+ * @param Słowo strojenia DDS.
+ * @param Kształt fali.
+ * @param Wzmocnienie Q15.
+ * @return Numer głosu.
+ */
+uint8_t Voice_NoteOn(uint8_t key, uint32_t tuningWord, uint8_t form, int16_t gain);
+/**
+ * @brief Wybrzmiewanie głosów grających klawisz.
+ *
+ * @param Klawisz (półton).
+ */
+void Voice_NoteOff(uint8_t key);
+/**
+ * @brief Zmiana wysokości głosu bez ponownego startu obwiedni (legato, portamento).
+ *
+ * @param Numer głosu.
+ * @param Słowo strojenia DDS.
+ */
+void Voice_SetPitch(uint8_t v, uint32_t tuningWord);
+/**
+ * @brief Zmiana kształtu fali grających głosów.
+ *
+ * @param Kształt fali.
+ */
+void Voice_SetForm(uint8_t form);
+/**
+ * @brief Dodanie wszystkich aktywnych głosów do bloku miksera.
+ *				Pętla po głosach na zewnątrz - stan głosu w rejestrach przez cały blok.
+ *				Koszt na głos i próbkę: Wave_Interp + 2x ASRS, MULS, 2x ADDS i zapis
+ *				(ok. 28 cykli). Poziom obwiedni ustawia Env_Tick przed mikserem.
+ *
+ * @param Akumulator bloku (Q15, suma głosów).
+ * @param Liczba próbek.
+ */
+void Voice_Mix(int32_t *mix, uint32_t count);
+
+#endif /* VOICE_H */
@@ -0,0 +1,11 @@
+#include "wavetable.h"
+
+#define WAVE_BAND_ROW(t)	{ t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7] }
+
+// Kolejność zgodna z waveForm (0-sinus, 1-trojkat, 2-pila); sinus ma jedną harmoniczną
+// i jedną tablicę dla wszystkich pasm
+const int16_t * const waveTables[WAVE_COUNT][WAVE_BANDS] = {
+	{ waveSine, waveSine, waveSine, waveSine, waveSine, waveSine, waveSine, waveSine },
+	WAVE_BAND_ROW(waveTriangle),
+	WAVE_BAND_ROW(waveSaw)
+};
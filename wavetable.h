@@ -0,0 +1,60 @@
+/**
+ * @file wavetable.h
+ * @author Maciej Kucharski
+ * @brief Oscylator tablicowy - tablice 256 x 16 bit (Q15) z interpolacją liniową,
+ *				pasmowo ograniczone zestawy tablic wybierane według słowa strojenia.
+ */
+
+#ifndef WAVETABLE_H
+#define WAVETABLE_H
+
+#include "main.h"
+
+#define WAVE_BITS		8										// Rozmiar tablicy = 2^WAVE_BITS
+#define WAVE_LEN		(1 << WAVE_BITS)
+#define WAVE_FRAC_BITS	15								// Ułamek fazy między próbkami tablicy
+#define WAVE_COUNT	3										// Sinus, trojkat, pila
+#define WAVE_BANDS	8										// Pasma (oktawy słowa strojenia) dla tablic ograniczonych
+
+// Tablice w pamięci Flash (wavetables.c, generowane przez tools/gen_wavetables.py)
+extern const int16_t waveSine[WAVE_LEN + 1];
+extern const int16_t waveTriangle[WAVE_BANDS][WAVE_LEN + 1];
+extern const int16_t waveSaw[WAVE_BANDS][WAVE_LEN + 1];
+extern const uint8_t waveBand[256];
+extern const int16_t * const waveTables[WAVE_COUNT][WAVE_BANDS];
+
+/**
+ * @brief Tablica kształtu fali pasmowo ograniczona dla danego słowa strojenia:
+ *				najwyższa harmoniczna tablicy leży poniżej częstotliwości Nyquista.
+ *				Dwa odczyty z Flash, wywoływane przy zmianie nuty lub kształtu.
+ *
+ * @param Kształt fali (0-sinus, 1-trojkat, 2-pila).
+ * @param Słowo strojenia DDS.
+ * @return Tablica WAVE_LEN + 1 próbek dla Wave_Interp.
+ */
+__STATIC_INLINE const int16_t *Wave_Select(uint8_t form, uint32_t tuningWord)
+{
+	return waveTables[form][waveBand[tuningWord >> 24]];
+}
+
+/**
+ * @brief Próbka z tablicy dla fazy DDS, interpolacja liniowa między sąsiednimi
+ *				punktami. Indeks z 8 najstarszych bitów fazy, ułamek z kolejnych 15.
+ *				Tablica ma WAVE_LEN + 1 punktów, więc idx + 1 nie wymaga zawijania.
+ *				Koszt (Cortex-M0+, wstawione w miejscu wywołania): 2x LDRSH, MULS
+ *				i 6 operacji ALU - ok. 15 cykli na próbkę przy Flash bez stanów
+ *				oczekiwania, ok. 17 z jednym stanem oczekiwania.
+ *
+ * @param Tablica WAVE_LEN + 1 próbek.
+ * @param Faza (32-bitowy akumulator DDS).
+ * @return Próbka Q15 (-32767 - 32767).
+ */
+__STATIC_INLINE int32_t Wave_Interp(const int16_t *table, uint32_t phase)
+{
+	uint32_t idx = phase >> (32 - WAVE_BITS);
+	int32_t frac = (int32_t)((phase >> (32 - WAVE_BITS - WAVE_FRAC_BITS)) & ((1 << WAVE_FRAC_BITS) - 1));
+	int32_t a = table[idx];
+	return a + (((table[idx + 1] - a) * frac) >> WAVE_FRAC_BITS);	// |różnica| < 2^16, iloczyn < 2^31
+}
+
+#endif /* WAVETABLE_H */
@@ -0,0 +1,433 @@
+/* Plik generowany przez tools/gen_wavetables.py - nie edytowac recznie. */
+
+#include "wavetable.h"
+
+// Sinus
+const int16_t waveSine[WAVE_LEN + 1] = {
+	     0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,
+	  9512,  10278,  11039,  11793,  12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+	 18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,  23170,  23731,  24279,  24811,
+	 25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+	 30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,
+	 32609,  32678,  32728,  32757,  32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+	 32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,  30273,  29956,  29621,  29268,
+	 28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+	 23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,
+	 15446,  14732,  14010,  13279,  12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+	  6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,      0,   -804,  -1608,  -2410,
+	 -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+	-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159,
+	-20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+	-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+	-31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+	-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580,
+	-31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+	-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403,
+	-20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+	-12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,
+	 -3212,  -2410,  -1608,   -804,      0
+};
+
+// Trojkat - tablice pasmowo ograniczone, pasmo = waveBand[slowo >> 24]
+const int16_t waveTriangle[WAVE_BANDS][WAVE_LEN + 1] = {
+	{	// pasmo 0: do 127 harmonicznej
+		     0,    514,   1027,   1541,   2054,   2568,   3082,   3595,   4109,   4622,   5136,   5650,
+		  6163,   6677,   7191,   7704,   8218,   8731,   9245,   9759,  10272,  10786,  11299,  11813,
+		 12327,  12840,  13354,  13867,  14381,  14895,  15408,  15922,  16436,  16949,  17463,  17976,
+		 18490,  19004,  19517,  20031,  20544,  21058,  21572,  22085,  22599,  23113,  23626,  24140,
+		 24653,  25167,  25680,  26194,  26708,  27222,  27735,  28249,  28762,  29276,  29789,  30304,
+		 30815,  31332,  31840,  32370,  32767,  32370,  31840,  31332,  30815,  30304,  29789,  29276,
+		 28762,  28249,  27735,  27222,  26708,  26194,  25680,  25167,  24653,  24140,  23626,  23113,
+		 22599,  22085,  21572,  21058,  20544,  20031,  19517,  19004,  18490,  17976,  17463,  16949,
+		 16436,  15922,  15408,  14895,  14381,  13867,  13354,  12840,  12327,  11813,  11299,  10786,
+		 10272,   9759,   9245,   8731,   8218,   7704,   7191,   6677,   6163,   5650,   5136,   4622,
+		  4109,   3595,   3082,   2568,   2054,   1541,   1027,    514,      0,   -514,  -1027,  -1541,
+		 -2054,  -2568,  -3082,  -3595,  -4109,  -4622,  -5136,  -5650,  -6163,  -6677,  -7191,  -7704,
+		 -8218,  -8731,  -9245,  -9759, -10272, -10786, -11299, -11813, -12327, -12840, -13354, -13867,
+		-14381, -14895, -15408, -15922, -16436, -16949, -17463, -17976, -18490, -19004, -19517, -20031,
+		-20544, -21058, -21572, -22085, -22599, -23113, -23626, -24140, -24653, -25167, -25680, -26194,
+		-26708, -27222, -27735, -28249, -28762, -29276, -29789, -30304, -30815, -31332, -31840, -32370,
+		-32767, -32370, -31840, -31332, -30815, -30304, -29789, -29276, -28762, -28249, -27735, -27222,
+		-26708, -26194, -25680, -25167, -24653, -24140, -23626, -23113, -22599, -22085, -21572, -21058,
+		-20544, -20031, -19517, -19004, -18490, -17976, -17463, -16949, -16436, -15922, -15408, -14895,
+		-14381, -13867, -13354, -12840, -12327, -11813, -11299, -10786, -10272,  -9759,  -9245,  -8731,
+		 -8218,  -7704,  -7191,  -6677,  -6163,  -5650,  -5136,  -4622,  -4109,  -3595,  -3082,  -2568,
+		 -2054,  -1541,  -1027,   -514,      0
+	},
+	{	// pasmo 1: do 64 harmonicznej
+		     0,    512,   1030,   1549,   2061,   2573,   3091,   3610,   4122,   4634,   5152,   5671,
+		  6183,   6695,   7213,   7732,   8244,   8756,   9274,   9793,  10305,  10816,  11336,  11855,
+		 12366,  12877,  13397,  13916,  14427,  14938,  15458,  15977,  16488,  16998,  17519,  18039,
+		 18549,  19059,  19580,  20100,  20610,  21119,  21641,  22162,  22670,  23179,  23702,  24225,
+		 24731,  25238,  25763,  26288,  26792,  27296,  27825,  28353,  28851,  29351,  29889,  30424,
+		 30906,  31393,  31970,  32526,  32767,  32526,  31970,  31393,  30906,  30424,  29889,  29351,
+		 28851,  28353,  27825,  27296,  26792,  26288,  25763,  25238,  24731,  24225,  23702,  23179,
+		 22670,  22162,  21641,  21119,  20610,  20100,  19580,  19059,  18549,  18039,  17519,  16998,
+		 16488,  15977,  15458,  14938,  14427,  13916,  13397,  12877,  12366,  11855,  11336,  10816,
+		 10305,   9793,   9274,   8756,   8244,   7732,   7213,   6695,   6183,   5671,   5152,   4634,
+		  4122,   3610,   3091,   2573,   2061,   1549,   1030,    512,      0,   -512,  -1030,  -1549,
+		 -2061,  -2573,  -3091,  -3610,  -4122,  -4634,  -5152,  -5671,  -6183,  -6695,  -7213,  -7732,
+		 -8244,  -8756,  -9274,  -9793, -10305, -10816, -11336, -11855, -12366, -12877, -13397, -13916,
+		-14427, -14938, -15458, -15977, -16488, -16998, -17519, -18039, -18549, -19059, -19580, -20100,
+		-20610, -21119, -21641, -22162, -22670, -23179, -23702, -24225, -24731, -25238, -25763, -26288,
+		-26792, -27296, -27825, -28353, -28851, -29351, -29889, -30424, -30906, -31393, -31970, -32526,
+		-32767, -32526, -31970, -31393, -30906, -30424, -29889, -29351, -28851, -28353, -27825, -27296,
+		-26792, -26288, -25763, -25238, -24731, -24225, -23702, -23179, -22670, -22162, -21641, -21119,
+		-20610, -20100, -19580, -19059, -18549, -18039, -17519, -16998, -16488, -15977, -15458, -14938,
+		-14427, -13916, -13397, -12877, -12366, -11855, -11336, -10816, -10305,  -9793,  -9274,  -8756,
+		 -8244,  -7732,  -7213,  -6695,  -6183,  -5671,  -5152,  -4634,  -4122,  -3610,  -3091,  -2573,
+		 -2061,  -1549,  -1030,   -512,      0
+	},
+	{	// pasmo 2: do 32 harmonicznej
+		     0,    509,   1024,   1546,   2074,   2602,   3125,   3639,   4148,   4657,   5172,   5695,
+		  6223,   6751,   7274,   7788,   8296,   8805,   9319,   9842,  10371,  10901,  11423,  11937,
+		 12445,  12952,  13466,  13990,  14520,  15051,  15574,  16087,  16592,  17098,  17611,  18136,
+		 18669,  19202,  19727,  20238,  20740,  21242,  21754,  22281,  22819,  23357,  23883,  24391,
+		 24886,  25380,  25890,  26423,  26973,  27523,  28052,  28549,  29022,  29495,  30001,  30560,
+		 31162,  31761,  32282,  32640,  32767,  32640,  32282,  31761,  31162,  30560,  30001,  29495,
+		 29022,  28549,  28052,  27523,  26973,  26423,  25890,  25380,  24886,  24391,  23883,  23357,
+		 22819,  22281,  21754,  21242,  20740,  20238,  19727,  19202,  18669,  18136,  17611,  17098,
+		 16592,  16087,  15574,  15051,  14520,  13990,  13466,  12952,  12445,  11937,  11423,  10901,
+		 10371,   9842,   9319,   8805,   8296,   7788,   7274,   6751,   6223,   5695,   5172,   4657,
+		  4148,   3639,   3125,   2602,   2074,   1546,   1024,    509,      0,   -509,  -1024,  -1546,
+		 -2074,  -2602,  -3125,  -3639,  -4148,  -4657,  -5172,  -5695,  -6223,  -6751,  -7274,  -7788,
+		 -8296,  -8805,  -9319,  -9842, -10371, -10901, -11423, -11937, -12445, -12952, -13466, -13990,
+		-14520, -15051, -15574, -16087, -16592, -17098, -17611, -18136, -18669, -19202, -19727, -20238,
+		-20740, -21242, -21754, -22281, -22819, -23357, -23883, -24391, -24886, -25380, -25890, -26423,
+		-26973, -27523, -28052, -28549, -29022, -29495, -30001, -30560, -31162, -31761, -32282, -32640,
+		-32767, -32640, -32282, -31761, -31162, -30560, -30001, -29495, -29022, -28549, -28052, -27523,
+		-26973, -26423, -25890, -25380, -24886, -24391, -23883, -23357, -22819, -22281, -21754, -21242,
+		-20740, -20238, -19727, -19202, -18669, -18136, -17611, -17098, -16592, -16087, -15574, -15051,
+		-14520, -13990, -13466, -12952, -12445, -11937, -11423, -10901, -10371,  -9842,  -9319,  -8805,
+		 -8296,  -7788,  -7274,  -6751,  -6223,  -5695,  -5172,  -4657,  -4148,  -3639,  -3125,  -2602,
+		 -2074,  -1546,  -1024,   -509,      0
+	},
+	{	// pasmo 3: do 16 harmonicznej
+		     0,    505,   1013,   1527,   2048,   2578,   3115,   3658,   4203,   4749,   5292,   5829,
+		  6358,   6879,   7392,   7898,   8402,   8905,   9412,   9925,  10446,  10977,  11516,  12062,
+		 12612,  13161,  13707,  14246,  14775,  15293,  15802,  16303,  16800,  17297,  17798,  18308,
+		 18829,  19363,  19910,  20466,  21027,  21588,  22143,  22688,  23217,  23728,  24223,  24705,
+		 25179,  25654,  26137,  26637,  27161,  27713,  28293,  28896,  29514,  30131,  30729,  31288,
+		 31785,  32198,  32509,  32702,  32767,  32702,  32509,  32198,  31785,  31288,  30729,  30131,
+		 29514,  28896,  28293,  27713,  27161,  26637,  26137,  25654,  25179,  24705,  24223,  23728,
+		 23217,  22688,  22143,  21588,  21027,  20466,  19910,  19363,  18829,  18308,  17798,  17297,
+		 16800,  16303,  15802,  15293,  14775,  14246,  13707,  13161,  12612,  12062,  11516,  10977,
+		 10446,   9925,   9412,   8905,   8402,   7898,   7392,   6879,   6358,   5829,   5292,   4749,
+		  4203,   3658,   3115,   2578,   2048,   1527,   1013,    505,      0,   -505,  -1013,  -1527,
+		 -2048,  -2578,  -3115,  -3658,  -4203,  -4749,  -5292,  -5829,  -6358,  -6879,  -7392,  -7898,
+		 -8402,  -8905,  -9412,  -9925, -10446, -10977, -11516, -12062, -12612, -13161, -13707, -14246,
+		-14775, -15293, -15802, -16303, -16800, -17297, -17798, -18308, -18829, -19363, -19910, -20466,
+		-21027, -21588, -22143, -22688, -23217, -23728, -24223, -24705, -25179, -25654, -26137, -26637,
+		-27161, -27713, -28293, -28896, -29514, -30131, -30729, -31288, -31785, -32198, -32509, -32702,
+		-32767, -32702, -32509, -32198, -31785, -31288, -30729, -30131, -29514, -28896, -28293, -27713,
+		-27161, -26637, -26137, -25654, -25179, -24705, -24223, -23728, -23217, -22688, -22143, -21588,
+		-21027, -20466, -19910, -19363, -18829, -18308, -17798, -17297, -16800, -16303, -15802, -15293,
+		-14775, -14246, -13707, -13161, -12612, -12062, -11516, -10977, -10446,  -9925,  -9412,  -8905,
+		 -8402,  -7898,  -7392,  -6879,  -6358,  -5829,  -5292,  -4749,  -4203,  -3658,  -3115,  -2578,
+		 -2048,  -1527,  -1013,   -505,      0
+	},
+	{	// pasmo 4: do 8 harmonicznej
+		     0,    497,    996,   1498,   2005,   2517,   3037,   3565,   4100,   4645,   5198,   5759,
+		  6327,   6901,   7480,   8063,   8648,   9232,   9815,  10394,  10967,  11535,  12094,  12644,
+		 13184,  13714,  14234,  14745,  15246,  15740,  16228,  16711,  17193,  17674,  18157,  18646,
+		 19141,  19646,  20162,  20692,  21235,  21794,  22368,  22957,  23561,  24177,  24803,  25437,
+		 26074,  26712,  27345,  27969,  28577,  29165,  29727,  30257,  30749,  31198,  31599,  31946,
+		 32237,  32467,  32633,  32733,  32767,  32733,  32633,  32467,  32237,  31946,  31599,  31198,
+		 30749,  30257,  29727,  29165,  28577,  27969,  27345,  26712,  26074,  25437,  24803,  24177,
+		 23561,  22957,  22368,  21794,  21235,  20692,  20162,  19646,  19141,  18646,  18157,  17674,
+		 17193,  16711,  16228,  15740,  15246,  14745,  14234,  13714,  13184,  12644,  12094,  11535,
+		 10967,  10394,   9815,   9232,   8648,   8063,   7480,   6901,   6327,   5759,   5198,   4645,
+		  4100,   3565,   3037,   2517,   2005,   1498,    996,    497,      0,   -497,   -996,  -1498,
+		 -2005,  -2517,  -3037,  -3565,  -4100,  -4645,  -5198,  -5759,  -6327,  -6901,  -7480,  -8063,
+		 -8648,  -9232,  -9815, -10394, -10967, -11535, -12094, -12644, -13184, -13714, -14234, -14745,
+		-15246, -15740, -16228, -16711, -17193, -17674, -18157, -18646, -19141, -19646, -20162, -20692,
+		-21235, -21794, -22368, -22957, -23561, -24177, -24803, -25437, -26074, -26712, -27345, -27969,
+		-28577, -29165, -29727, -30257, -30749, -31198, -31599, -31946, -32237, -32467, -32633, -32733,
+		-32767, -32733, -32633, -32467, -32237, -31946, -31599, -31198, -30749, -30257, -29727, -29165,
+		-28577, -27969, -27345, -26712, -26074, -25437, -24803, -24177, -23561, -22957, -22368, -21794,
+		-21235, -20692, -20162, -19646, -19141, -18646, -18157, -17674, -17193, -16711, -16228, -15740,
+		-15246, -14745, -14234, -13714, -13184, -12644, -12094, -11535, -10967, -10394,  -9815,  -9232,
+		 -8648,  -8063,  -7480,  -6901,  -6327,  -5759,  -5198,  -4645,  -4100,  -3565,  -3037,  -2517,
+		 -2005,  -1498,   -996,   -497,      0
+	},
+	{	// pasmo 5: do 4 harmonicznej
+		     0,    483,    966,   1452,   1939,   2431,   2926,   3427,   3933,   4445,   4965,   5492,
+		  6028,   6572,   7124,   7687,   8258,   8839,   9430,  10031,  10641,  11260,  11888,  12525,
+		 13170,  13823,  14482,  15148,  15819,  16494,  17173,  17854,  18536,  19218,  19899,  20577,
+		 21252,  21921,  22583,  23237,  23881,  24514,  25134,  25740,  26329,  26902,  27455,  27988,
+		 28499,  28987,  29451,  29889,  30299,  30681,  31034,  31357,  31648,  31907,  32133,  32326,
+		 32484,  32607,  32696,  32749,  32767,  32749,  32696,  32607,  32484,  32326,  32133,  31907,
+		 31648,  31357,  31034,  30681,  30299,  29889,  29451,  28987,  28499,  27988,  27455,  26902,
+		 26329,  25740,  25134,  24514,  23881,  23237,  22583,  21921,  21252,  20577,  19899,  19218,
+		 18536,  17854,  17173,  16494,  15819,  15148,  14482,  13823,  13170,  12525,  11888,  11260,
+		 10641,  10031,   9430,   8839,   8258,   7687,   7124,   6572,   6028,   5492,   4965,   4445,
+		  3933,   3427,   2926,   2431,   1939,   1452,    966,    483,      0,   -483,   -966,  -1452,
+		 -1939,  -2431,  -2926,  -3427,  -3933,  -4445,  -4965,  -5492,  -6028,  -6572,  -7124,  -7687,
+		 -8258,  -8839,  -9430, -10031, -10641, -11260, -11888, -12525, -13170, -13823, -14482, -15148,
+		-15819, -16494, -17173, -17854, -18536, -19218, -19899, -20577, -21252, -21921, -22583, -23237,
+		-23881, -24514, -25134, -25740, -26329, -26902, -27455, -27988, -28499, -28987, -29451, -29889,
+		-30299, -30681, -31034, -31357, -31648, -31907, -32133, -32326, -32484, -32607, -32696, -32749,
+		-32767, -32749, -32696, -32607, -32484, -32326, -32133, -31907, -31648, -31357, -31034, -30681,
+		-30299, -29889, -29451, -28987, -28499, -27988, -27455, -26902, -26329, -25740, -25134, -24514,
+		-23881, -23237, -22583, -21921, -21252, -20577, -19899, -19218, -18536, -17854, -17173, -16494,
+		-15819, -15148, -14482, -13823, -13170, -12525, -11888, -11260, -10641, -10031,  -9430,  -8839,
+		 -8258,  -7687,  -7124,  -6572,  -6028,  -5492,  -4965,  -4445,  -3933,  -3427,  -2926,  -2431,
+		 -1939,  -1452,   -966,   -483,      0
+	},
+	{	// pasmo 6: do 2 harmonicznej
+		     0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,
+		  9512,  10278,  11039,  11793,  12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+		 18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,  23170,  23731,  24279,  24811,
+		 25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+		 30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,
+		 32609,  32678,  32728,  32757,  32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+		 32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,  30273,  29956,  29621,  29268,
+		 28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+		 23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,
+		 15446,  14732,  14010,  13279,  12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+		  6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,      0,   -804,  -1608,  -2410,
+		 -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+		-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159,
+		-20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+		-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+		-31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+		-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580,
+		-31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+		-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403,
+		-20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+		-12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,
+		 -3212,  -2410,  -1608,   -804,      0
+	},
+	{	// pasmo 7: do 1 harmonicznej
+		     0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,
+		  9512,  10278,  11039,  11793,  12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+		 18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,  23170,  23731,  24279,  24811,
+		 25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+		 30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,
+		 32609,  32678,  32728,  32757,  32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+		 32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,  30273,  29956,  29621,  29268,
+		 28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+		 23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,
+		 15446,  14732,  14010,  13279,  12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+		  6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,      0,   -804,  -1608,  -2410,
+		 -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+		-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159,
+		-20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+		-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+		-31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+		-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580,
+		-31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+		-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403,
+		-20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+		-12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,
+		 -3212,  -2410,  -1608,   -804,      0
+	}
+};
+
+// Pila - tablice pasmowo ograniczone, pasmo = waveBand[slowo >> 24]
+const int16_t waveSaw[WAVE_BANDS][WAVE_LEN + 1] = {
+	{	// pasmo 0: do 127 harmonicznej
+		     0,    219,    435,    658,    871,   1097,   1306,   1536,   1742,   1975,   2177,   2414,
+		  2613,   2853,   3048,   3292,   3483,   3731,   3919,   4170,   4354,   4609,   4790,   5048,
+		  5225,   5487,   5660,   5926,   6095,   6365,   6531,   6804,   6966,   7243,   7401,   7682,
+		  7836,   8121,   8271,   8561,   8706,   9000,   9141,   9440,   9576,   9879,  10011,  10319,
+		 10445,  10758,  10880,  11198,  11315,  11638,  11749,  12078,  12183,  12518,  12618,  12958,
+		 13052,  13398,  13486,  13838,  13920,  14279,  14353,  14720,  14787,  15161,  15220,  15602,
+		 15653,  16043,  16086,  16485,  16518,  16927,  16951,  17369,  17382,  17812,  17814,  18255,
+		 18245,  18699,  18675,  19143,  19105,  19588,  19534,  20033,  19962,  20480,  20390,  20927,
+		 20816,  21376,  21241,  21827,  21664,  22279,  22085,  22733,  22503,  23191,  22918,  23652,
+		 23329,  24118,  23734,  24591,  24132,  25073,  24518,  25569,  24887,  26085,  25230,  26637,
+		 25525,  27253,  25729,  28009,  25705,  29174,  24823,  32767,      0, -32767, -24823, -29174,
+		-25705, -28009, -25729, -27253, -25525, -26637, -25230, -26085, -24887, -25569, -24518, -25073,
+		-24132, -24591, -23734, -24118, -23329, -23652, -22918, -23191, -22503, -22733, -22085, -22279,
+		-21664, -21827, -21241, -21376, -20816, -20927, -20390, -20480, -19962, -20033, -19534, -19588,
+		-19105, -19143, -18675, -18699, -18245, -18255, -17814, -17812, -17382, -17369, -16951, -16927,
+		-16518, -16485, -16086, -16043, -15653, -15602, -15220, -15161, -14787, -14720, -14353, -14279,
+		-13920, -13838, -13486, -13398, -13052, -12958, -12618, -12518, -12183, -12078, -11749, -11638,
+		-11315, -11198, -10880, -10758, -10445, -10319, -10011,  -9879,  -9576,  -9440,  -9141,  -9000,
+		 -8706,  -8561,  -8271,  -8121,  -7836,  -7682,  -7401,  -7243,  -6966,  -6804,  -6531,  -6365,
+		 -6095,  -5926,  -5660,  -5487,  -5225,  -5048,  -4790,  -4609,  -4354,  -4170,  -3919,  -3731,
+		 -3483,  -3292,  -3048,  -2853,  -2613,  -2414,  -2177,  -1975,  -1742,  -1536,  -1306,  -1097,
+		  -871,   -658,   -435,   -219,      0
+	},
+	{	// pasmo 1: do 64 harmonicznej
+		     0,     81,    444,    799,    873,    961,   1331,   1679,   1747,   1842,   2218,   2560,
+		  2620,   2722,   3105,   3440,   3493,   3602,   3992,   4320,   4366,   4482,   4880,   5200,
+		  5239,   5362,   5768,   6080,   6111,   6243,   6656,   6961,   6984,   7123,   7544,   7841,
+		  7856,   8003,   8433,   8721,   8727,   8884,   9322,   9601,   9598,   9764,  10211,  10481,
+		 10469,  10644,  11101,  11361,  11339,  11525,  11992,  12241,  12208,  12405,  12884,  13121,
+		 13076,  13285,  13777,  14001,  13943,  14166,  14671,  14881,  14809,  15046,  15566,  15761,
+		 15673,  15927,  16463,  16641,  16535,  16807,  17363,  17521,  17395,  17688,  18266,  18401,
+		 18251,  18569,  19172,  19280,  19103,  19450,  20083,  20159,  19949,  20331,  21001,  21038,
+		 20787,  21213,  21928,  21916,  21614,  22096,  22869,  22794,  22424,  22980,  23831,  23669,
+		 23208,  23866,  24828,  24541,  23944,  24758,  25890,  25404,  24587,  25666,  27093,  26239,
+		 25001,  26629,  28707,  26938,  24552,  28041,  32767,  24500,      0, -24500, -32767, -28041,
+		-24552, -26938, -28707, -26629, -25001, -26239, -27093, -25666, -24587, -25404, -25890, -24758,
+		-23944, -24541, -24828, -23866, -23208, -23669, -23831, -22980, -22424, -22794, -22869, -22096,
+		-21614, -21916, -21928, -21213, -20787, -21038, -21001, -20331, -19949, -20159, -20083, -19450,
+		-19103, -19280, -19172, -18569, -18251, -18401, -18266, -17688, -17395, -17521, -17363, -16807,
+		-16535, -16641, -16463, -15927, -15673, -15761, -15566, -15046, -14809, -14881, -14671, -14166,
+		-13943, -14001, -13777, -13285, -13076, -13121, -12884, -12405, -12208, -12241, -11992, -11525,
+		-11339, -11361, -11101, -10644, -10469, -10481, -10211,  -9764,  -9598,  -9601,  -9322,  -8884,
+		 -8727,  -8721,  -8433,  -8003,  -7856,  -7841,  -7544,  -7123,  -6984,  -6961,  -6656,  -6243,
+		 -6111,  -6080,  -5768,  -5362,  -5239,  -5200,  -4880,  -4482,  -4366,  -4320,  -3992,  -3602,
+		 -3493,  -3440,  -3105,  -2722,  -2620,  -2560,  -2218,  -1842,  -1747,  -1679,  -1331,   -961,
+		  -873,   -799,   -444,    -81,      0
+	},
+	{	// pasmo 2: do 32 harmonicznej
+		     0,     23,    167,    479,    906,   1325,   1618,   1742,   1757,   1788,   1951,   2283,
+		  2719,   3130,   3402,   3506,   3513,   3552,   3736,   4089,   4533,   4935,   5187,   5270,
+		  5268,   5316,   5521,   5895,   6348,   6741,   6971,   7032,   7021,   7078,   7306,   7702,
+		  8165,   8549,   8755,   8793,   8771,   8839,   9091,   9513,   9985,  10359,  10539,  10550,
+		 10518,  10597,  10876,  11326,  11810,  12171,  12323,  12304,  12259,  12351,  12662,  13144,
+		 13642,  13989,  14106,  14053,  13993,  14100,  14448,  14968,  15482,  15813,  15889,  15793,
+		 15716,  15841,  16235,  16802,  17336,  17646,  17670,  17522,  17421,  17570,  18023,  18651,
+		 19211,  19494,  19450,  19231,  19100,  19281,  19814,  20526,  21122,  21366,  21226,  20906,
+		 20732,  20959,  21611,  22447,  23098,  23283,  22993,  22513,  22269,  22573,  23423,  24472,
+		 25217,  25297,  24732,  23953,  23574,  24033,  25292,  26797,  27752,  27582,  26333,  24762,
+		 24003,  24948,  27616,  30886,  32767,  31153,  24754,  13774,      0, -13774, -24754, -31153,
+		-32767, -30886, -27616, -24948, -24003, -24762, -26333, -27582, -27752, -26797, -25292, -24033,
+		-23574, -23953, -24732, -25297, -25217, -24472, -23423, -22573, -22269, -22513, -22993, -23283,
+		-23098, -22447, -21611, -20959, -20732, -20906, -21226, -21366, -21122, -20526, -19814, -19281,
+		-19100, -19231, -19450, -19494, -19211, -18651, -18023, -17570, -17421, -17522, -17670, -17646,
+		-17336, -16802, -16235, -15841, -15716, -15793, -15889, -15813, -15482, -14968, -14448, -14100,
+		-13993, -14053, -14106, -13989, -13642, -13144, -12662, -12351, -12259, -12304, -12323, -12171,
+		-11810, -11326, -10876, -10597, -10518, -10550, -10539, -10359,  -9985,  -9513,  -9091,  -8839,
+		 -8771,  -8793,  -8755,  -8549,  -8165,  -7702,  -7306,  -7078,  -7021,  -7032,  -6971,  -6741,
+		 -6348,  -5895,  -5521,  -5316,  -5268,  -5270,  -5187,  -4935,  -4533,  -4089,  -3736,  -3552,
+		 -3513,  -3506,  -3402,  -3130,  -2719,  -2283,  -1951,  -1788,  -1757,  -1742,  -1618,  -1325,
+		  -906,   -479,   -167,    -23,      0
+	},
+	{	// pasmo 3: do 16 harmonicznej
+		     0,      6,     49,    157,    352,    638,   1007,   1436,   1893,   2341,   2745,   3077,
+		  3319,   3469,   3540,   3557,   3555,   3570,   3637,   3784,   4024,   4355,   4762,   5217,
+		  5683,   6122,   6500,   6792,   6987,   7091,   7122,   7112,   7100,   7125,   7220,   7408,
+		  7697,   8078,   8528,   9012,   9488,   9917,  10265,  10512,  10654,  10703,  10687,  10646,
+		 10623,  10659,  10787,  11025,  11374,  11816,  12318,  12836,  13325,  13741,  14052,  14243,
+		 14316,  14296,  14221,  14139,  14101,  14152,  14323,  14628,  15056,  15580,  16153,  16720,
+		 17227,  17625,  17883,  17993,  17969,  17849,  17686,  17544,  17485,  17558,  17796,  18202,
+		 18755,  19407,  20093,  20738,  21273,  21641,  21812,  21785,  21593,  21298,  20981,  20730,
+		 20631,  20747,  21110,  21714,  22512,  23423,  24341,  25150,  25746,  26047,  26018,  25672,
+		 25076,  24344,  23627,  23088,  22880,  23119,  23866,  25105,  26737,  28585,  30401,  31897,
+		 32767,  32727,  31546,  29080,  25286,  20244,  14142,   7273,      0,  -7273, -14142, -20244,
+		-25286, -29080, -31546, -32727, -32767, -31897, -30401, -28585, -26737, -25105, -23866, -23119,
+		-22880, -23088, -23627, -24344, -25076, -25672, -26018, -26047, -25746, -25150, -24341, -23423,
+		-22512, -21714, -21110, -20747, -20631, -20730, -20981, -21298, -21593, -21785, -21812, -21641,
+		-21273, -20738, -20093, -19407, -18755, -18202, -17796, -17558, -17485, -17544, -17686, -17849,
+		-17969, -17993, -17883, -17625, -17227, -16720, -16153, -15580, -15056, -14628, -14323, -14152,
+		-14101, -14139, -14221, -14296, -14316, -14243, -14052, -13741, -13325, -12836, -12318, -11816,
+		-11374, -11025, -10787, -10659, -10623, -10646, -10687, -10703, -10654, -10512, -10265,  -9917,
+		 -9488,  -9012,  -8528,  -8078,  -7697,  -7408,  -7220,  -7125,  -7100,  -7112,  -7122,  -7091,
+		 -6987,  -6792,  -6500,  -6122,  -5683,  -5217,  -4762,  -4355,  -4024,  -3784,  -3637,  -3570,
+		 -3555,  -3557,  -3540,  -3469,  -3319,  -3077,  -2745,  -2341,  -1893,  -1436,  -1007,   -638,
+		  -352,   -157,    -49,     -6,      0
+	},
+	{	// pasmo 4: do 8 harmonicznej
+		     0,      2,     14,     46,    107,    206,    347,    536,    775,   1064,   1400,   1781,
+		  2200,   2649,   3120,   3602,   4085,   4559,   5014,   5440,   5828,   6173,   6469,   6714,
+		  6907,   7049,   7146,   7202,   7225,   7224,   7210,   7193,   7185,   7197,   7238,   7318,
+		  7443,   7621,   7853,   8141,   8483,   8876,   9314,   9789,  10291,  10809,  11332,  11846,
+		 12340,  12803,  13225,  13596,  13910,  14163,  14353,  14482,  14552,  14570,  14545,  14488,
+		 14410,  14325,  14248,  14191,  14170,  14195,  14278,  14427,  14648,  14943,  15313,  15753,
+		 16257,  16815,  17415,  18043,  18682,  19316,  19926,  20495,  21009,  21452,  21813,  22084,
+		 22259,  22338,  22323,  22221,  22045,  21809,  21530,  21231,  20933,  20661,  20439,  20290,
+		 20236,  20296,  20484,  20812,  21284,  21901,  22656,  23536,  24523,  25591,  26711,  27847,
+		 28961,  30010,  30950,  31738,  32331,  32686,  32767,  32541,  31980,  31065,  29783,  28130,
+		 26111,  23738,  21034,  18028,  14758,  11269,   7609,   3834,      0,  -3834,  -7609, -11269,
+		-14758, -18028, -21034, -23738, -26111, -28130, -29783, -31065, -31980, -32541, -32767, -32686,
+		-32331, -31738, -30950, -30010, -28961, -27847, -26711, -25591, -24523, -23536, -22656, -21901,
+		-21284, -20812, -20484, -20296, -20236, -20290, -20439, -20661, -20933, -21231, -21530, -21809,
+		-22045, -22221, -22323, -22338, -22259, -22084, -21813, -21452, -21009, -20495, -19926, -19316,
+		-18682, -18043, -17415, -16815, -16257, -15753, -15313, -14943, -14648, -14427, -14278, -14195,
+		-14170, -14191, -14248, -14325, -14410, -14488, -14545, -14570, -14552, -14482, -14353, -14163,
+		-13910, -13596, -13225, -12803, -12340, -11846, -11332, -10809, -10291,  -9789,  -9314,  -8876,
+		 -8483,  -8141,  -7853,  -7621,  -7443,  -7318,  -7238,  -7197,  -7185,  -7193,  -7210,  -7224,
+		 -7225,  -7202,  -7146,  -7049,  -6907,  -6714,  -6469,  -6173,  -5828,  -5440,  -5014,  -4559,
+		 -4085,  -3602,  -3120,  -2649,  -2200,  -1781,  -1400,  -1064,   -775,   -536,   -347,   -206,
+		  -107,    -46,    -14,     -2,      0
+	},
+	{	// pasmo 5: do 4 harmonicznej
+		     0,      1,      4,     14,     34,     65,    112,    176,    261,    368,    499,    657,
+		   841,   1054,   1296,   1568,   1869,   2199,   2558,   2944,   3357,   3794,   4253,   4734,
+		  5231,   5745,   6270,   6805,   7346,   7889,   8432,   8971,   9503,  10023,  10530,  11020,
+		 11490,  11937,  12359,  12754,  13119,  13453,  13755,  14024,  14260,  14461,  14629,  14764,
+		 14867,  14939,  14983,  15000,  14993,  14965,  14919,  14859,  14787,  14709,  14627,  14546,
+		 14471,  14405,  14353,  14319,  14306,  14320,  14363,  14439,  14551,  14703,  14895,  15131,
+		 15412,  15739,  16114,  16535,  17002,  17516,  18073,  18672,  19311,  19986,  20694,  21430,
+		 22190,  22968,  23760,  24558,  25358,  26152,  26934,  27696,  28431,  29133,  29793,  30405,
+		 30962,  31457,  31882,  32231,  32499,  32680,  32767,  32757,  32645,  32427,  32101,  31663,
+		 31113,  30449,  29670,  28778,  27773,  26657,  25434,  24106,  22677,  21152,  19537,  17837,
+		 16060,  14213,  12302,  10337,   8326,   6278,   4201,   2105,      0,  -2105,  -4201,  -6278,
+		 -8326, -10337, -12302, -14213, -16060, -17837, -19537, -21152, -22677, -24106, -25434, -26657,
+		-27773, -28778, -29670, -30449, -31113, -31663, -32101, -32427, -32645, -32757, -32767, -32680,
+		-32499, -32231, -31882, -31457, -30962, -30405, -29793, -29133, -28431, -27696, -26934, -26152,
+		-25358, -24558, -23760, -22968, -22190, -21430, -20694, -19986, -19311, -18672, -18073, -17516,
+		-17002, -16535, -16114, -15739, -15412, -15131, -14895, -14703, -14551, -14439, -14363, -14320,
+		-14306, -14319, -14353, -14405, -14471, -14546, -14627, -14709, -14787, -14859, -14919, -14965,
+		-14993, -15000, -14983, -14939, -14867, -14764, -14629, -14461, -14260, -14024, -13755, -13453,
+		-13119, -12754, -12359, -11937, -11490, -11020, -10530, -10023,  -9503,  -8971,  -8432,  -7889,
+		 -7346,  -6805,  -6270,  -5745,  -5231,  -4734,  -4253,  -3794,  -3357,  -2944,  -2558,  -2199,
+		 -1869,  -1568,  -1296,  -1054,   -841,   -657,   -499,   -368,   -261,   -176,   -112,    -65,
+		   -34,    -14,     -4,     -1,      0
+	},
+	{	// pasmo 6: do 2 harmonicznej
+		     0,      0,      1,      5,     12,     23,     40,     63,     95,    134,    184,    244,
+		   315,    399,    497,    608,    735,    877,   1036,   1211,   1404,   1615,   1845,   2094,
+		  2362,   2650,   2957,   3285,   3633,   4000,   4388,   4796,   5224,   5672,   6139,   6625,
+		  7129,   7652,   8192,   8749,   9322,   9910,  10513,  11130,  11760,  12401,  13054,  13716,
+		 14387,  15065,  15750,  16439,  17132,  17828,  18524,  19220,  19914,  20605,  21291,  21971,
+		 22644,  23307,  23959,  24599,  25226,  25837,  26432,  27008,  27565,  28101,  28614,  29103,
+		 29568,  30005,  30415,  30796,  31147,  31466,  31753,  32006,  32224,  32407,  32554,  32663,
+		 32734,  32767,  32760,  32714,  32627,  32500,  32331,  32121,  31870,  31578,  31243,  30867,
+		 30450,  29992,  29493,  28953,  28374,  27755,  27097,  26401,  25667,  24898,  24092,  23252,
+		 22379,  21473,  20535,  19568,  18572,  17549,  16500,  15426,  14330,  13212,  12075,  10920,
+		  9748,   8562,   7363,   6153,   4933,   3706,   2474,   1238,      0,  -1238,  -2474,  -3706,
+		 -4933,  -6153,  -7363,  -8562,  -9748, -10920, -12075, -13212, -14330, -15426, -16500, -17549,
+		-18572, -19568, -20535, -21473, -22379, -23252, -24092, -24898, -25667, -26401, -27097, -27755,
+		-28374, -28953, -29493, -29992, -30450, -30867, -31243, -31578, -31870, -32121, -32331, -32500,
+		-32627, -32714, -32760, -32767, -32734, -32663, -32554, -32407, -32224, -32006, -31753, -31466,
+		-31147, -30796, -30415, -30005, -29568, -29103, -28614, -28101, -27565, -27008, -26432, -25837,
+		-25226, -24599, -23959, -23307, -22644, -21971, -21291, -20605, -19914, -19220, -18524, -17828,
+		-17132, -16439, -15750, -15065, -14387, -13716, -13054, -12401, -11760, -11130, -10513,  -9910,
+		 -9322,  -8749,  -8192,  -7652,  -7129,  -6625,  -6139,  -5672,  -5224,  -4796,  -4388,  -4000,
+		 -3633,  -3285,  -2957,  -2650,  -2362,  -2094,  -1845,  -1615,  -1404,  -1211,  -1036,   -877,
+		  -735,   -608,   -497,   -399,   -315,   -244,   -184,   -134,    -95,    -63,    -40,    -23,
+		   -12,     -5,     -1,      0,      0
+	},
+	{	// pasmo 7: do 1 harmonicznej
+		     0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,
+		  9512,  10278,  11039,  11793,  12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,
+		 18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,  23170,  23731,  24279,  24811,
+		 25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+		 30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,
+		 32609,  32678,  32728,  32757,  32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,
+		 32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,  30273,  29956,  29621,  29268,
+		 28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+		 23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,
+		 15446,  14732,  14010,  13279,  12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,
+		  6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,      0,   -804,  -1608,  -2410,
+		 -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+		-12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159,
+		-20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+		-27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+		-31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+		-32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580,
+		-31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+		-27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403,
+		-20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+		-12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,
+		 -3212,  -2410,  -1608,   -804,      0
+	}
+};
+
+// Numer pasma dla 8 najstarszych bitow slowa strojenia
+const uint8_t waveBand[256] = {
+	0, 1, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
+};